@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Generates src/FlightDataRecorderSchema_data.cpp from the model *_types.h structs.
+
+Run from src/fbw after the model code was regenerated:
+
+    python3 scripts/generate_flight_data_recorder_schema.py
+"""
+
+import re
+from pathlib import Path
+
+ROOT = Path(__file__).resolve().parent.parent / "src"
+
+TYPE_HEADERS = [
+    "model/AutopilotStateMachine_types.h",
+    "model/AutopilotLaws_types.h",
+    "model/Autothrust_types.h",
+    "model/FlyByWire_types.h",
+    "EngineData.h",
+]
+
+# members of FlightDataRecorderSample in order
+RECORDED_STRUCTS = [
+    ("ap_sm", "ap_sm_output"),
+    ("ap_law", "ap_raw_output"),
+    ("athr", "athr_out"),
+    ("fbw", "fbw_output"),
+    ("engine", "EngineData"),
+]
+
+
+def parse_structs():
+    structs = {}
+    for header in TYPE_HEADERS:
+        text = (ROOT / header).read_text()
+        for match in re.finditer(r"struct (\w+)\s*\{(.*?)\};", text, re.S):
+            if match.group(1) in structs:
+                continue
+            members = re.findall(r"^\s*([\w ]+?)\s+(\w+);", match.group(2), re.M)
+            structs[match.group(1)] = members
+    return structs
+
+
+def walk(structs, type_name, path, fields):
+    if type_name in structs:
+        for member_type, member_name in structs[type_name]:
+            walk(structs, member_type, path + "." + member_name, fields)
+    else:
+        fields.append(path)
+
+
+def main():
+    structs = parse_structs()
+    fields = []
+    for member, type_name in RECORDED_STRUCTS:
+        walk(structs, type_name, member, fields)
+
+    lines = [
+        "// generated by scripts/generate_flight_data_recorder_schema.py from the model *_types.h structs, do not edit",
+        "",
+        '#include "FlightDataRecorderSchema.h"',
+        "",
+        "#define FIELD(path) FlightDataRecorderSchema::makeField<decltype(std::declval<FlightDataRecorderSample&>().path)>(#path, offsetof(FlightDataRecorderSample, path))",
+        "",
+        "const std::vector<FlightDataRecorderSchema::Field>& FlightDataRecorderSchema::getFields() {",
+        "  static const std::vector<Field> fields = {",
+    ]
+    lines += ["      FIELD(%s)," % field for field in fields]
+    lines += [
+        "  };",
+        "  return fields;",
+        "}",
+        "",
+        "#undef FIELD",
+        "",
+    ]
+    (ROOT / "FlightDataRecorderSchema_data.cpp").write_text("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,8 +1,8 @@
-#include <dirent.h>
 #include <ini.h>
 #include <ini_type_conversion.h>
 #include <stdio.h>
 #include <chrono>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -23,6 +23,24 @@ void FlightDataRecorder::initialize() {
     iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_FILES"] = "15";
     iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE"] = "864000";
+    iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_TOTAL_SIZE_MB"] = "0";
+    iniStructure["FLIGHT_DATA_RECORDER"]["FORMAT_VERSION"] = "2";
+    iniStructure["FLIGHT_DATA_RECORDER"]["SAMPLES_PER_BLOCK"] = "256";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BLOCK_ENCODING"] = "COLUMNAR";
+    iniStructure["FLIGHT_DATA_RECORDER"]["COMPRESSION_CODEC"] = "DEFLATE";
+    iniStructure["FLIGHT_DATA_RECORDER"]["COMPRESSION_LEVEL"] = "-1";
+    iniStructure["FLIGHT_DATA_RECORDER"]["COMPRESSION_STRATEGY"] = "DEFAULT";
+    iniStructure["FLIGHT_DATA_RECORDER"]["WRITE_MODE"] = "BUFFERED";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BUFFER_SIZE"] = "256";
+    iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_SAMPLES_PER_DRAIN"] = "4";
+    iniStructure["FLIGHT_DATA_RECORDER"]["COMPRESSION_TIME_BUDGET_US"] = "500";
+    iniStructure["FLIGHT_DATA_RECORDER"]["MAXIMUM_OUTSTANDING_BYTES"] = "1048576";
+    iniStructure["FLIGHT_DATA_RECORDER"]["RECORDING_MODE"] = "CONTINUOUS";
+    iniStructure["FLIGHT_DATA_RECORDER"]["BACKGROUND_RATE_HZ"] = "5";
+    iniStructure["FLIGHT_DATA_RECORDER"]["PRE_TRIGGER_SECONDS"] = "10";
+    iniStructure["FLIGHT_DATA_RECORDER"]["POST_TRIGGER_SECONDS"] = "30";
+    iniStructure["FLIGHT_DATA_RECORDER"]["PRE_TRIGGER_BUFFER_SIZE"] = "600";
+    iniStructure["FLIGHT_DATA_RECORDER"]["STATISTICS_INTERVAL_SECONDS"] = "0";
     iniFile.write(iniStructure, true);
   }
 
@@ -30,12 +48,111 @@ void FlightDataRecorder::initialize() {
   isEnabled = INITypeConversion::getBoolean(iniStructure, "FLIGHT_DATA_RECORDER", "ENABLED", true);
   maximumFileCount = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_FILES", 15);
   maximumSampleCounter = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE", 864000);
+  maximumTotalSize =
+      static_cast<uint64_t>(max(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_TOTAL_SIZE_MB", 0), 0)) << 20;
+  formatVersion = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "FORMAT_VERSION", 2);
+  samplesPerBlock = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "SAMPLES_PER_BLOCK", 256);
+  bufferSize = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "BUFFER_SIZE", 256);
+  maximumSamplesPerDrain = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_SAMPLES_PER_DRAIN", 4);
+  compressionTimeBudget =
+      chrono::microseconds(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "COMPRESSION_TIME_BUDGET_US", 500));
+  maximumOutstandingBytes = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "MAXIMUM_OUTSTANDING_BYTES", 1048576);
+  auto backgroundRate = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "BACKGROUND_RATE_HZ", 5);
+  backgroundInterval = backgroundRate > 0 ? 1.0 / backgroundRate : 0;
+  preTriggerDuration = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "PRE_TRIGGER_SECONDS", 10);
+  postTriggerDuration = INITypeConversion::getDouble(iniStructure, "FLIGHT_DATA_RECORDER", "POST_TRIGGER_SECONDS", 30);
+  preTriggerBufferSize = INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "PRE_TRIGGER_BUFFER_SIZE", 600);
+  statisticsInterval = chrono::seconds(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "STATISTICS_INTERVAL_SECONDS", 0));
+
+  // read write mode
+  auto writeModeString = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "WRITE_MODE", "BUFFERED");
+  if (writeModeString == "DIRECT") {
+    writeMode = WriteMode::DIRECT;
+  } else if (writeModeString == "INCREMENTAL") {
+    writeMode = WriteMode::INCREMENTAL;
+  } else {
+    writeModeString = "BUFFERED";
+    writeMode = WriteMode::BUFFERED;
+  }
+
+  // read block encoding
+  auto blockEncodingString = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "BLOCK_ENCODING", "COLUMNAR");
+  if (blockEncodingString == "ROWS") {
+    blockEncoding = FlightDataRecorderFormat::BLOCK_ENCODING_ROWS;
+  } else if (blockEncodingString == "SPARSE") {
+    blockEncoding = FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE;
+  } else {
+    blockEncodingString = "COLUMNAR";
+    blockEncoding = FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR;
+  }
+
+  // read compression settings
+  auto compressionCodecString = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "COMPRESSION_CODEC", "DEFLATE");
+  if (compressionCodecString == "NONE") {
+    compressionCodec = FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE;
+  } else {
+    compressionCodecString = "DEFLATE";
+    compressionCodec = FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE;
+  }
+  compressionLevel = max(min(INITypeConversion::getInteger(iniStructure, "FLIGHT_DATA_RECORDER", "COMPRESSION_LEVEL", -1), 9), -1);
+  auto compressionStrategyString = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "COMPRESSION_STRATEGY", "DEFAULT");
+  compressionStrategy = FlightDataRecorderCompressor::getStrategy(compressionStrategyString);
+  if (compressionStrategy == Z_DEFAULT_STRATEGY) {
+    compressionStrategyString = "DEFAULT";
+  }
+
+  // read recording mode
+  auto recordingModeString = INITypeConversion::getString(iniStructure, "FLIGHT_DATA_RECORDER", "RECORDING_MODE", "CONTINUOUS");
+  if (recordingModeString == "TRIGGERED") {
+    recordingMode = RecordingMode::TRIGGERED;
+  } else {
+    recordingModeString = "CONTINUOUS";
+    recordingMode = RecordingMode::CONTINUOUS;
+  }
 
   // print configuration
   cout << "WASM: Flight Data Recorder Configuration : Enabled                        = " << isEnabled << endl;
   cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfFiles           = " << maximumFileCount << endl;
   cout << "WASM: Flight Data Recorder Configuration : MaximumNumberOfEntriesPerFile  = " << maximumSampleCounter << endl;
+  cout << "WASM: Flight Data Recorder Configuration : MaximumTotalSize               = " << (maximumTotalSize >> 20) << " MB" << endl;
+  cout << "WASM: Flight Data Recorder Configuration : FormatVersion                  = " << formatVersion << endl;
+  cout << "WASM: Flight Data Recorder Configuration : SamplesPerBlock                = " << samplesPerBlock << endl;
+  cout << "WASM: Flight Data Recorder Configuration : BlockEncoding                  = " << blockEncodingString << endl;
+  cout << "WASM: Flight Data Recorder Configuration : CompressionCodec               = " << compressionCodecString << endl;
+  cout << "WASM: Flight Data Recorder Configuration : CompressionLevel               = " << compressionLevel << endl;
+  cout << "WASM: Flight Data Recorder Configuration : CompressionStrategy            = " << compressionStrategyString << endl;
+  cout << "WASM: Flight Data Recorder Configuration : WriteMode                      = " << writeModeString << endl;
+  cout << "WASM: Flight Data Recorder Configuration : BufferSize                     = " << bufferSize << endl;
+  cout << "WASM: Flight Data Recorder Configuration : MaximumSamplesPerDrain         = " << maximumSamplesPerDrain << endl;
+  cout << "WASM: Flight Data Recorder Configuration : CompressionTimeBudget          = " << compressionTimeBudget.count() << " us" << endl;
+  cout << "WASM: Flight Data Recorder Configuration : MaximumOutstandingBytes        = " << maximumOutstandingBytes << endl;
+  cout << "WASM: Flight Data Recorder Configuration : RecordingMode                  = " << recordingModeString << endl;
+  if (recordingMode == RecordingMode::TRIGGERED) {
+    cout << "WASM: Flight Data Recorder Configuration : BackgroundRate                 = " << backgroundRate << " Hz" << endl;
+    cout << "WASM: Flight Data Recorder Configuration : PreTriggerDuration             = " << preTriggerDuration << " s" << endl;
+    cout << "WASM: Flight Data Recorder Configuration : PostTriggerDuration            = " << postTriggerDuration << " s" << endl;
+    cout << "WASM: Flight Data Recorder Configuration : PreTriggerBufferSize           = " << preTriggerBufferSize << endl;
+  }
+  cout << "WASM: Flight Data Recorder Configuration : StatisticsInterval             = " << statisticsInterval.count() << " s" << endl;
   cout << "WASM: Flight Data Recorder Configuration : Interface Version              = " << INTERFACE_VERSION << endl;
+
+  // fields that change with every sample are written by the sparse encoding without checking for changes
+  sparseAlwaysSet = FlightDataRecorderSparseBlock::getAlwaysChangingFields(FlightDataRecorderSchema::getFields());
+
+  // read list of existing files
+  if (isEnabled) {
+    manifest.load(MANIFEST_FILEPATH, "\\work", ".fdr");
+  }
+
+  // preallocate pre-trigger window
+  if (isEnabled && recordingMode == RecordingMode::TRIGGERED) {
+    preTriggerBuffer.initialize(preTriggerBufferSize);
+  }
+
+  // start writer stage
+  if (isEnabled && writeMode == WriteMode::BUFFERED) {
+    startWriter();
+  }
 }
 
 void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateMachine,
@@ -48,22 +165,379 @@ void FlightDataRecorder::update(AutopilotStateMachineModelClass* autopilotStateM
     return;
   }
 
+  // record and measure time needed
+  auto start = chrono::high_resolution_clock::now();
+  recordUpdate(autopilotStateMachine, autopilotLaws, autoThrust, flyByWire, engineData);
+  auto end = chrono::high_resolution_clock::now();
+  statistics.updateTime.add(end - start);
+  fileStatistics.updateTime.add(end - start);
+
+  // print periodic summary
+  if (statisticsInterval.count() > 0 && end - lastStatisticsOutput >= statisticsInterval) {
+    lastStatisticsOutput = end;
+    printStatistics();
+  }
+}
+
+void FlightDataRecorder::recordUpdate(AutopilotStateMachineModelClass* autopilotStateMachine,
+                                      AutopilotLawsModelClass* autopilotLaws,
+                                      AutothrustModelClass* autoThrust,
+                                      FlyByWireModelClass* flyByWire,
+                                      const EngineData& engineData) {
+  if (writeMode != WriteMode::BUFFERED) {
+    // collect and queue data for compression
+    currentSample.ap_sm = autopilotStateMachine->getExternalOutputs().out;
+    currentSample.ap_law = autopilotLaws->getExternalOutputs().out.output;
+    currentSample.athr = autoThrust->getExternalOutputs().out;
+    currentSample.fbw = flyByWire->getExternalOutputs().out;
+    currentSample.engine = engineData;
+    recordSample(currentSample);
+
+    // compress and write data, in incremental mode only as much as the budget allows unless the backlog is too large,
+    // in direct mode everything (all of a block in the update that completed it)
+    auto budget = chrono::microseconds::zero();
+    if (writeMode == WriteMode::INCREMENTAL && compressor.getOutstandingBytes() <= maximumOutstandingBytes) {
+      budget = compressionTimeBudget;
+    }
+    compressor.process(budget);
+    peakOutstandingBytes = max(peakOutstandingBytes, compressor.getOutstandingBytes());
+    return;
+  }
+
+  // copy data into a free slot, the sample is dropped when the writer stage falls behind
+  auto slot = sampleBuffer.beginWrite();
+  if (slot != nullptr) {
+    slot->ap_sm = autopilotStateMachine->getExternalOutputs().out;
+    slot->ap_law = autopilotLaws->getExternalOutputs().out.output;
+    slot->athr = autoThrust->getExternalOutputs().out;
+    slot->fbw = flyByWire->getExternalOutputs().out;
+    slot->engine = engineData;
+    sampleBuffer.endWrite();
+  }
+
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+  // wake up writer thread
+  writerCondition.notify_one();
+#else
+  // drain a limited number of samples per frame and compress only as much as the budget allows
+  drainSampleBuffer(maximumSamplesPerDrain, compressionTimeBudget);
+#endif
+}
+
+void FlightDataRecorder::terminate() {
+  // stop writer stage and write remaining samples
+  if (isEnabled && writeMode == WriteMode::BUFFERED) {
+    stopWriter();
+  }
+
+  // release the rest of a trigger window and the pre-trigger window at the background rate
+  if (isEnabled && recordingMode == RecordingMode::TRIGGERED) {
+    while (preTriggerBuffer.getSize() > 0) {
+      releaseOldestPreTriggerSample();
+    }
+    cout << "WASM: Flight Data Recorder Statistics    : Triggers                       = " << numberOfTriggers << endl;
+  }
+
+  // print compression statistics
+  if (isEnabled && writeMode != WriteMode::DIRECT) {
+    cout << "WASM: Flight Data Recorder Statistics    : OutstandingBytes               = " << compressor.getOutstandingBytes() << endl;
+    cout << "WASM: Flight Data Recorder Statistics    : PeakOutstandingBytes           = " << peakOutstandingBytes << endl;
+  }
+
+  // finish and close file
+  closeFlightDataRecorderFile();
+
+  // print recorder statistics
+  if (isEnabled) {
+    printStatistics();
+  }
+}
+
+size_t FlightDataRecorder::getOutstandingBytes() const {
+  return compressor.getOutstandingBytes();
+}
+
+FlightDataRecorderFormat::Statistics FlightDataRecorder::getStatistics() const {
+  // include current file
+  auto result = statistics.get();
+  if (isFileOpen) {
+    result.bytesIn += compressor.getBytesQueued();
+    result.bytesOut += compressor.getBytesWritten();
+  }
+  return result;
+}
+
+void FlightDataRecorder::printStatistics() const {
+  FlightDataRecorderStatistics::print(cout, "WASM: Flight Data Recorder Statistics    : ", getStatistics());
+}
+
+void FlightDataRecorder::startWriter() {
+  // preallocate sample slots
+  sampleBuffer.initialize(bufferSize);
+
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+  writerStopRequested = false;
+  writerThread = thread(&FlightDataRecorder::writerThreadLoop, this);
+#endif
+}
+
+void FlightDataRecorder::stopWriter() {
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+  if (writerThread.joinable()) {
+    {
+      lock_guard<mutex> lock(writerMutex);
+      writerStopRequested = true;
+    }
+    writerCondition.notify_one();
+    writerThread.join();
+  }
+#endif
+
+  // write everything that is still buffered
+  drainSampleBuffer(sampleBuffer.getCapacity(), chrono::microseconds::zero());
+
+  // print buffer statistics
+  cout << "WASM: Flight Data Recorder Statistics    : DroppedSamples                 = " << sampleBuffer.getDroppedSamples() << endl;
+  cout << "WASM: Flight Data Recorder Statistics    : BufferHighWaterMark            = " << sampleBuffer.getHighWaterMark() << " / "
+       << sampleBuffer.getCapacity() << endl;
+}
+
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+void FlightDataRecorder::writerThreadLoop() {
+  while (true) {
+    {
+      // wait until there is work or the writer should stop
+      unique_lock<mutex> lock(writerMutex);
+      writerCondition.wait_for(lock, chrono::milliseconds(100), [this] { return writerStopRequested || sampleBuffer.getSize() > 0; });
+      if (writerStopRequested) {
+        return;
+      }
+    }
+
+    // write everything that is available
+    drainSampleBuffer(sampleBuffer.getCapacity(), chrono::microseconds::zero());
+  }
+}
+#endif
+
+size_t FlightDataRecorder::drainSampleBuffer(size_t maximumNumberOfSamples, chrono::microseconds budget) {
+  // with a budget the samples stay in the ring while the compressor works off its backlog over the next calls
+  size_t numberOfSamples = 0;
+  const FlightDataRecorderSample* sample;
+  while (numberOfSamples < maximumNumberOfSamples && (budget.count() == 0 || compressor.getOutstandingBytes() <= maximumOutstandingBytes) &&
+         (sample = sampleBuffer.beginRead()) != nullptr) {
+    recordSample(*sample);
+    sampleBuffer.endRead();
+    numberOfSamples++;
+  }
+
+  // compress and write data, a budget of zero writes everything
+  compressor.process(budget);
+  peakOutstandingBytes = max(peakOutstandingBytes, compressor.getOutstandingBytes());
+
+  return numberOfSamples;
+}
+
+void FlightDataRecorder::recordSample(const FlightDataRecorderSample& sample) {
+  if (recordingMode == RecordingMode::CONTINUOUS) {
+    writeSample(sample);
+    return;
+  }
+
+  // a trigger (re)starts the post-trigger window, a simulation time jump back ends it
+  auto simulationTime = sample.ap_sm.time.simulation_time;
+  if (isTriggerActive(sample)) {
+    if (!isTriggered) {
+      numberOfTriggers++;
+    }
+    isTriggered = true;
+    postTriggerEndTime = simulationTime + postTriggerDuration;
+  } else if (isTriggered && (simulationTime > postTriggerEndTime || simulationTime < postTriggerEndTime - postTriggerDuration)) {
+    isTriggered = false;
+  }
+
+  // within the trigger window every buffered sample is written at full rate, but only a few of them per update so the
+  // trigger costs no more than a normal update, later samples queue up behind them to keep the order
+  if (isTriggered) {
+    numberOfFullRateSamples = preTriggerBuffer.getSize();
+  }
+  for (int i = 0; i < max(maximumSamplesPerDrain, 1) && numberOfFullRateSamples > 0; i++) {
+    releaseOldestPreTriggerSample();
+  }
+  if (isTriggered && numberOfFullRateSamples == 0) {
+    writeSample(sample);
+    lastBackgroundTime = simulationTime;
+    hasBackgroundSample = true;
+    return;
+  }
+
+  // keep sample in the pre-trigger window, samples leaving the window are written at the background rate
+  if (preTriggerBuffer.getSize() >= preTriggerBuffer.getCapacity()) {
+    releaseOldestPreTriggerSample();
+  }
+  auto slot = preTriggerBuffer.beginWrite();
+  if (slot == nullptr) {
+    // window has no capacity -> background rate only
+    if (isTriggered || !hasBackgroundSample || simulationTime - lastBackgroundTime >= backgroundInterval ||
+        simulationTime < lastBackgroundTime) {
+      writeSample(sample);
+      lastBackgroundTime = simulationTime;
+      hasBackgroundSample = true;
+    }
+    return;
+  }
+  *slot = sample;
+  preTriggerBuffer.endWrite();
+  if (isTriggered) {
+    numberOfFullRateSamples++;
+    return;
+  }
+
+  const FlightDataRecorderSample* oldest;
+  while (numberOfFullRateSamples == 0 && (oldest = preTriggerBuffer.beginRead()) != nullptr &&
+         simulationTime - oldest->ap_sm.time.simulation_time > preTriggerDuration) {
+    releaseOldestPreTriggerSample();
+  }
+}
+
+bool FlightDataRecorder::isTriggerActive(const FlightDataRecorderSample& sample) {
+  return sample.ap_sm.input.FDR_event || sample.fbw.sim.data_computed.high_aoa_prot_active ||
+         sample.fbw.sim.data_computed.high_speed_prot_active;
+}
+
+void FlightDataRecorder::releaseOldestPreTriggerSample() {
+  auto sample = preTriggerBuffer.beginRead();
+  if (sample == nullptr) {
+    return;
+  }
+
+  // samples of a trigger window are written at full rate, all others only if they match the background rate
+  auto simulationTime = sample->ap_sm.time.simulation_time;
+  auto isFullRate = numberOfFullRateSamples > 0;
+  if (isFullRate) {
+    numberOfFullRateSamples--;
+  }
+  if (isFullRate || !hasBackgroundSample || simulationTime - lastBackgroundTime >= backgroundInterval ||
+      simulationTime < lastBackgroundTime) {
+    writeSample(*sample);
+    lastBackgroundTime = simulationTime;
+    hasBackgroundSample = true;
+  }
+  preTriggerBuffer.endRead();
+}
+
+void FlightDataRecorder::writeSample(const FlightDataRecorderSample& sample) {
   // do file management
   manageFlightDataRecorderFiles();
+  statistics.addSample();
+  fileStatistics.addSample();
+
+  // remember extent of the file for the manifest
+  if (fileSampleCount++ == 0) {
+    fileFirstSimulationTime = sample.ap_sm.time.simulation_time;
+  }
+  fileLastSimulationTime = sample.ap_sm.time.simulation_time;
+
+  // legacy format -> queue data for compression
+  if (formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    compressor.queue(&sample, sizeof(sample));
+    return;
+  }
 
-  // write data to file
-  fileStream->write((char*)(&autopilotStateMachine->getExternalOutputs().out), sizeof(autopilotStateMachine->getExternalOutputs().out));
-  fileStream->write((char*)(&autopilotLaws->getExternalOutputs().out.output), sizeof(autopilotLaws->getExternalOutputs().out.output));
-  fileStream->write((char*)(&autoThrust->getExternalOutputs().out), sizeof(autoThrust->getExternalOutputs().out));
-  fileStream->write((char*)(&flyByWire->getExternalOutputs().out), sizeof(flyByWire->getExternalOutputs().out));
-  fileStream->write((char*)(&engineData), sizeof(engineData));
+  // add to current block and hand it over for compression when full
+  if (getBlockSampleCount() == 0) {
+    blockFirstSimulationTime = sample.ap_sm.time.simulation_time;
+  }
+  blockLastSimulationTime = sample.ap_sm.time.simulation_time;
+  switch (blockEncoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS: {
+      auto bytes = reinterpret_cast<const unsigned char*>(&sample);
+      rowBlock.insert(rowBlock.end(), bytes, bytes + sizeof(sample));
+      break;
+    }
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      sparseBlock.add(&sample);
+      break;
+    default:
+      columnarBlock.add(&sample);
+      break;
+  }
+  if (getBlockSampleCount() >= static_cast<size_t>(max(samplesPerBlock, 1))) {
+    queueBlock();
+  }
 }
 
-void FlightDataRecorder::terminate() {
-  if (fileStream) {
-    fileStream->close();
-    fileStream.reset();
+size_t FlightDataRecorder::getBlockSampleCount() const {
+  switch (blockEncoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      return rowBlock.size() / sizeof(FlightDataRecorderSample);
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      return sparseBlock.getSampleCount();
+    default:
+      return columnarBlock.getSampleCount();
+  }
+}
+
+void FlightDataRecorder::queueSchema() {
+  // serialize field list
+  const auto& fields = FlightDataRecorderSchema::getFields();
+  vector<unsigned char> data;
+  FlightDataRecorderSchema::serialize(fields, data);
+
+  // create schema header
+  vector<unsigned char> header(sizeof(FlightDataRecorderFormat::SchemaHeader));
+  FlightDataRecorderFormat::SchemaHeader schemaHeader = {};
+  schemaHeader.fieldCount = static_cast<uint32_t>(fields.size());
+  schemaHeader.uncompressedSize = static_cast<uint32_t>(data.size());
+  memcpy(header.data(), &schemaHeader, sizeof(schemaHeader));
+
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_SCHEMA, std::move(header), std::move(data), true);
+}
+
+void FlightDataRecorder::queueBlock() {
+  auto sampleCount = getBlockSampleCount();
+  if (sampleCount == 0) {
+    return;
   }
+
+  // encode block
+  vector<unsigned char> data;
+  switch (blockEncoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      data.swap(rowBlock);
+      rowBlock.reserve(data.size());
+      break;
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      sparseBlock.finish(data);
+      break;
+    default:
+      columnarBlock.finish(data);
+      break;
+  }
+
+  // create block header
+  vector<unsigned char> header(sizeof(FlightDataRecorderFormat::BlockHeader));
+  FlightDataRecorderFormat::BlockHeader blockHeader = {};
+  blockHeader.encoding = blockEncoding;
+  blockHeader.compression = compressionCodec;
+  blockHeader.sampleCount = static_cast<uint32_t>(sampleCount);
+  blockHeader.uncompressedSize = static_cast<uint32_t>(data.size());
+  blockHeader.firstSimulationTime = blockFirstSimulationTime;
+  blockHeader.lastSimulationTime = blockLastSimulationTime;
+  memcpy(header.data(), &blockHeader, sizeof(blockHeader));
+
+  // remember block for the index, the offset is known once the block was written
+  FlightDataRecorderFormat::IndexEntry indexEntry = {};
+  indexEntry.firstSampleIndex = blockIndexSampleCounter;
+  indexEntry.sampleCount = blockHeader.sampleCount;
+  indexEntry.firstSimulationTime = blockHeader.firstSimulationTime;
+  indexEntry.lastSimulationTime = blockHeader.lastSimulationTime;
+  blockIndex.push_back(indexEntry);
+  blockIndexSampleCounter += blockHeader.sampleCount;
+
+  // queue block for compression
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_BLOCK, std::move(header), std::move(data),
+                        compressionCodec == FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE);
 }
 
 void FlightDataRecorder::manageFlightDataRecorderFiles() {
@@ -71,71 +545,148 @@ void FlightDataRecorder::manageFlightDataRecorderFiles() {
   sampleCounter++;
 
   // check if file is considered full
+  bool isRotation = false;
+  chrono::high_resolution_clock::time_point rotationStart;
   if (sampleCounter >= maximumSampleCounter) {
-    // close file and delete
-    if (fileStream) {
-      fileStream->close();
-      fileStream.reset();
-    }
+    isRotation = true;
+    rotationStart = chrono::high_resolution_clock::now();
+    // finish and close file
+    closeFlightDataRecorderFile();
     // reset counter
     sampleCounter = 0;
   }
 
-  if (!fileStream) {
-    // create new file
-    fileStream = make_shared<gzofstream>(getFlightDataRecorderFilename().c_str());
-    // write version to file
-    fileStream->write((char*)&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
-    // clean up directory
-    cleanUpFlightDataRecorderFiles();
+  if (!compressor.isOpen()) {
+    // create new file and write header
+    auto filename = getFlightDataRecorderFilename();
+    if (formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+      // the gzip stream of legacy files is stored without compression for codec none
+      auto level = compressionCodec == FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE ? 0 : compressionLevel;
+      compressor.open(filename, FlightDataRecorderCompressor::Mode::STREAM, level, compressionStrategy);
+      compressor.queue(&INTERFACE_VERSION, sizeof(INTERFACE_VERSION));
+    } else {
+      FlightDataRecorderFormat::FileHeader fileHeader = {};
+      memcpy(fileHeader.magic, FlightDataRecorderFormat::MAGIC, sizeof(fileHeader.magic));
+      fileHeader.formatVersion = FlightDataRecorderFormat::FORMAT_VERSION;
+      fileHeader.sampleSize = sizeof(FlightDataRecorderSample);
+      fileHeader.interfaceVersion = INTERFACE_VERSION;
+      fileHeader.samplesPerBlock = samplesPerBlock;
+      compressor.open(filename, FlightDataRecorderCompressor::Mode::CHUNKED, compressionLevel, compressionStrategy);
+      compressor.queue(&fileHeader, sizeof(fileHeader));
+      queueSchema();
+      switch (blockEncoding) {
+        case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+          rowBlock.clear();
+          rowBlock.reserve(sizeof(FlightDataRecorderSample) * max(samplesPerBlock, 1));
+          break;
+        case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+          sparseBlock.initialize(FlightDataRecorderSchema::getFields(), sparseAlwaysSet, sizeof(FlightDataRecorderSample), samplesPerBlock);
+          break;
+        default:
+          columnarBlock.initialize(sizeof(FlightDataRecorderSample), samplesPerBlock);
+          break;
+      }
+      blockIndex.clear();
+      blockIndexSampleCounter = 0;
+    }
+    fileSampleCount = 0;
+    isFileOpen = compressor.isOpen();
+
+    // register file and remove the oldest ones, the manifest is saved here as well so that a file is listed (and later
+    // removed by retention) even if the simulator ends without closing it
+    manifest.add(filename);
+    manifest.applyRetention(maximumFileCount, maximumTotalSize);
+    manifest.save();
+
+    // statistics of a new file start with the rotation that created it
+    if (isRotation) {
+      fileStatistics.reset();
+      auto duration = chrono::high_resolution_clock::now() - rotationStart;
+      statistics.rotationTime.add(duration);
+      fileStatistics.rotationTime.add(duration);
+    }
   }
 }
 
-string FlightDataRecorder::getFlightDataRecorderFilename() {
-  // get time
-  auto in_time_t = chrono::system_clock::to_time_t(chrono::system_clock::now());
+void FlightDataRecorder::closeFlightDataRecorderFile() {
+  // queue partially filled block and append index
+  if (compressor.isOpen() && formatVersion != FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    queueBlock();
+    queueIndex();
+  }
 
-  // get filepath based on time
-  stringstream result;
-  result << put_time(gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S.fdr");
+  if (!compressor.isOpen()) {
+    return;
+  }
 
-  // return result
-  return result.str();
+  // finish and close file
+  compressor.close();
+  isFileOpen = false;
+  statistics.addBytes(compressor.getBytesQueued(), compressor.getBytesWritten());
+
+  // store final size in the manifest, the size limit can only be checked now
+  manifest.updateNewest(compressor.getBytesWritten(), fileSampleCount, fileFirstSimulationTime, fileLastSimulationTime);
+  manifest.applyRetention(maximumFileCount, maximumTotalSize);
+  manifest.save();
 }
 
-void FlightDataRecorder::cleanUpFlightDataRecorderFiles() {
-  // vector for directory entries
-  vector<string> files;
+void FlightDataRecorder::queueIndex() {
+  // write all outstanding blocks to know their offsets
+  compressor.process(chrono::microseconds::zero());
 
-  // extension
-  string extension = "fdr";
+  // fill in offsets of the blocks in the order they were written
+  size_t entry = 0;
+  for (const auto& location : compressor.getChunkLocations()) {
+    if (location.type == FlightDataRecorderFormat::CHUNK_TYPE_BLOCK && entry < blockIndex.size()) {
+      blockIndex[entry++].offset = location.offset;
+    }
+  }
 
-  // structure representing an directory entry
-  struct dirent* directoryEntry;
+  // index chunk follows directly
+  uint64_t indexOffset = compressor.getBytesWritten();
 
-  // open directory
-  DIR* directory = opendir("\\work");
+  // statistics of the file up to here
+  auto fileRecord = fileStatistics.get();
+  fileRecord.bytesIn = compressor.getBytesQueued();
+  fileRecord.bytesOut = indexOffset;
 
-  // read directory until end
-  while ((directoryEntry = readdir(directory)) != NULL) {
-    // get filename as string
-    string filename = directoryEntry->d_name;
+  // queue index and trailer
+  auto indexData = reinterpret_cast<const unsigned char*>(blockIndex.data());
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_INDEX, {},
+                        vector<unsigned char>(indexData, indexData + blockIndex.size() * sizeof(FlightDataRecorderFormat::IndexEntry)),
+                        false);
+  auto statisticsData = reinterpret_cast<const unsigned char*>(&fileRecord);
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_STATISTICS, {},
+                        vector<unsigned char>(statisticsData, statisticsData + sizeof(fileRecord)), false);
+  auto trailerData = reinterpret_cast<const unsigned char*>(&indexOffset);
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_TRAILER, {}, vector<unsigned char>(trailerData, trailerData + sizeof(indexOffset)),
+                        false);
+  blockIndex.clear();
+}
 
-    // check if file has right extension
-    if (filename.find(extension, (filename.length() - extension.length())) != string::npos) {
-      files.push_back(filename);
-    }
-  }
+string FlightDataRecorder::getFlightDataRecorderFilename() {
+  // get time
+  auto in_time_t = chrono::system_clock::to_time_t(chrono::system_clock::now());
 
-  // close directory
-  closedir(directory);
+  // get filepath based on time
+  stringstream name;
+  name << put_time(gmtime(&in_time_t), "\\work\\%Y-%m-%d-%H-%M-%S");
 
-  // sort vector
-  sort(files.begin(), files.end(), std::greater<>());
+  // files created within the same second get a counter to not overwrite each other
+  auto result = name.str() + ".fdr";
+  for (int counter = 1; manifest.contains(result) || fileExists(result); counter++) {
+    result = name.str() + "-" + to_string(counter) + ".fdr";
+  }
+
+  // return result
+  return result;
+}
 
-  // remove older files
-  while (files.size() > maximumFileCount) {
-    bool result = remove(("\\work\\" + files.back()).c_str());
-    files.pop_back();
+bool FlightDataRecorder::fileExists(const string& filename) {
+  auto file = fopen(filename.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
   }
+  fclose(file);
+  return true;
 }
@@ -1,18 +1,54 @@
 #pragma once
 
-#include <fstream>
+#include <atomic>
+#include <chrono>
 
 #include "AutopilotLaws.h"
 #include "AutopilotStateMachine.h"
 #include "Autothrust.h"
 #include "EngineData.h"
+#include "FlightDataRecorderColumnarBlock.h"
+#include "FlightDataRecorderCompressor.h"
+#include "FlightDataRecorderFormat.h"
+#include "FlightDataRecorderManifest.h"
+#include "FlightDataRecorderRingBuffer.h"
+#include "FlightDataRecorderSchema.h"
+#include "FlightDataRecorderSparseBlock.h"
+#include "FlightDataRecorderStatistics.h"
 #include "FlyByWire.h"
-#include "zfstream.h"
+
+// threads are not available in the WASM environment of the simulator -> writer stage is drained cooperatively
+#ifndef __wasm__
+#define FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+#endif
+
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
 
 class FlightDataRecorder {
  public:
   // IMPORTANT: this constant needs to increased with every interface change
-  const uint64_t INTERFACE_VERSION = 10;
+  static constexpr uint64_t INTERFACE_VERSION = 10;
+
+  enum class WriteMode {
+    // compress and write the sample within the update call, with blocks the update that completes a block deflates all
+    // of it (a spike of several milliseconds at the default block size), meant for offline and harness use
+    DIRECT,
+    // copy the sample into the ring buffer, compress and write it in the writer stage
+    BUFFERED,
+    // queue the sample and compress only as much as the time budget per update allows
+    INCREMENTAL,
+  };
+
+  enum class RecordingMode {
+    // write every sample
+    CONTINUOUS,
+    // write samples at the background rate, around triggers every sample is written
+    TRIGGERED,
+  };
 
   void initialize();
 
@@ -24,18 +60,118 @@ class FlightDataRecorder {
 
   void terminate();
 
+  // amount of queued data that was not yet compressed due to the time budget
+  size_t getOutstandingBytes() const;
+
+  // cost of the recorder since initialization
+  FlightDataRecorderFormat::Statistics getStatistics() const;
+
  private:
   const std::string CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+  const std::string MANIFEST_FILEPATH = "\\work\\FlightDataRecorder.manifest";
 
   bool isEnabled = false;
+  WriteMode writeMode = WriteMode::BUFFERED;
   int sampleCounter = false;
   int maximumSampleCounter = 0;
   int maximumFileCount = 0;
-  std::shared_ptr<gzofstream> fileStream;
+  uint64_t maximumTotalSize = 0;
+  int formatVersion = FlightDataRecorderFormat::FORMAT_VERSION;
+  int samplesPerBlock = 0;
+  FlightDataRecorderFormat::BlockEncoding blockEncoding = FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR;
+  FlightDataRecorderFormat::BlockCompression compressionCodec = FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE;
+  int compressionLevel = -1;
+  int compressionStrategy = 0;
+  int bufferSize = 0;
+  int maximumSamplesPerDrain = 0;
+  std::chrono::microseconds compressionTimeBudget = {};
+  size_t maximumOutstandingBytes = 0;
+  size_t peakOutstandingBytes = 0;
+
+  RecordingMode recordingMode = RecordingMode::CONTINUOUS;
+  double backgroundInterval = 0;
+  double preTriggerDuration = 0;
+  double postTriggerDuration = 0;
+  int preTriggerBufferSize = 0;
+  bool isTriggered = false;
+  // oldest samples in the pre-trigger window that belong to a trigger window and are released at full rate
+  size_t numberOfFullRateSamples = 0;
+  double postTriggerEndTime = 0;
+  double lastBackgroundTime = 0;
+  bool hasBackgroundSample = false;
+  uint64_t numberOfTriggers = 0;
+  FlightDataRecorderRingBuffer preTriggerBuffer;
+
+  FlightDataRecorderCompressor compressor;
+
+  FlightDataRecorderStatistics statistics;
+  FlightDataRecorderStatistics fileStatistics;
+  std::chrono::seconds statisticsInterval = {};
+  std::chrono::high_resolution_clock::time_point lastStatisticsOutput = {};
+  // file state for reading statistics from the update while the writer stage owns the compressor
+  std::atomic<bool> isFileOpen = false;
+
+  FlightDataRecorderManifest manifest;
+  uint64_t fileSampleCount = 0;
+  double fileFirstSimulationTime = 0;
+  double fileLastSimulationTime = 0;
+
+  FlightDataRecorderSample currentSample = {};
+  std::vector<unsigned char> rowBlock;
+  FlightDataRecorderColumnarBlock columnarBlock;
+  FlightDataRecorderSparseBlock sparseBlock;
+  std::vector<bool> sparseAlwaysSet;
+  double blockFirstSimulationTime = 0;
+  double blockLastSimulationTime = 0;
+  std::vector<FlightDataRecorderFormat::IndexEntry> blockIndex;
+  uint64_t blockIndexSampleCounter = 0;
+
+  FlightDataRecorderRingBuffer sampleBuffer;
+
+#ifdef FLIGHT_DATA_RECORDER_THREADS_AVAILABLE
+  std::thread writerThread;
+  std::mutex writerMutex;
+  std::condition_variable writerCondition;
+  bool writerStopRequested = false;
+
+  void writerThreadLoop();
+#endif
+
+  void recordUpdate(AutopilotStateMachineModelClass* autopilotStateMachine,
+                    AutopilotLawsModelClass* autopilotLaws,
+                    AutothrustModelClass* autoThrust,
+                    FlyByWireModelClass* flyByWire,
+                    const EngineData& engineData);
+
+  void printStatistics() const;
+
+  void startWriter();
+  void stopWriter();
+
+  // records up to the given number of samples from the ring and compresses within the budget, zero means unlimited
+  size_t drainSampleBuffer(size_t maximumNumberOfSamples, std::chrono::microseconds budget);
+
+  void recordSample(const FlightDataRecorderSample& sample);
+
+  static bool isTriggerActive(const FlightDataRecorderSample& sample);
+
+  void releaseOldestPreTriggerSample();
+
+  void writeSample(const FlightDataRecorderSample& sample);
+
+  void queueSchema();
+
+  size_t getBlockSampleCount() const;
+
+  void queueBlock();
+
+  void queueIndex();
 
   void manageFlightDataRecorderFiles();
 
+  void closeFlightDataRecorderFile();
+
   std::string getFlightDataRecorderFilename();
 
-  void cleanUpFlightDataRecorderFiles();
+  static bool fileExists(const std::string& filename);
 };
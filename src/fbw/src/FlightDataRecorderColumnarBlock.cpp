@@ -0,0 +1,80 @@
+#include "FlightDataRecorderColumnarBlock.h"
+
+#include <algorithm>
+#include <cstring>
+
+void FlightDataRecorderColumnarBlock::initialize(size_t sampleSize, size_t blockCapacity) {
+  numberOfWords = sampleSize / sizeof(uint64_t);
+  capacity = blockCapacity > 0 ? blockCapacity : 1;
+  sampleCount = 0;
+  previous.assign(numberOfWords, 0);
+  planes.assign(numberOfWords * sizeof(uint64_t) * capacity, 0);
+}
+
+void FlightDataRecorderColumnarBlock::add(const void* sample) {
+  auto bytes = static_cast<const unsigned char*>(sample);
+  for (size_t column = 0; column < numberOfWords; column++) {
+    // memcpy avoids unaligned access on the input
+    uint64_t word;
+    memcpy(&word, bytes + column * sizeof(uint64_t), sizeof(uint64_t));
+    uint64_t delta = word ^ previous[column];
+    previous[column] = word;
+
+    // scatter bytes into their planes
+    auto plane = planes.data() + column * sizeof(uint64_t) * capacity + sampleCount;
+    for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+      plane[byte * capacity] = static_cast<unsigned char>(delta >> (8 * byte));
+    }
+  }
+  sampleCount++;
+}
+
+size_t FlightDataRecorderColumnarBlock::getSampleCount() const {
+  return sampleCount;
+}
+
+bool FlightDataRecorderColumnarBlock::isEmpty() const {
+  return sampleCount == 0;
+}
+
+bool FlightDataRecorderColumnarBlock::isFull() const {
+  return sampleCount >= capacity;
+}
+
+void FlightDataRecorderColumnarBlock::finish(std::vector<unsigned char>& encoded) {
+  // copy planes without the unused tail of a partially filled block
+  auto numberOfPlanes = numberOfWords * sizeof(uint64_t);
+  encoded.resize(numberOfPlanes * sampleCount);
+  for (size_t plane = 0; plane < numberOfPlanes; plane++) {
+    memcpy(encoded.data() + plane * sampleCount, planes.data() + plane * capacity, sampleCount);
+  }
+
+  // start new block
+  sampleCount = 0;
+  std::fill(previous.begin(), previous.end(), 0);
+}
+
+void FlightDataRecorderColumnarBlock::decode(const unsigned char* encoded,
+                                             size_t sampleSize,
+                                             size_t sampleCount,
+                                             unsigned char* samples,
+                                             const std::vector<bool>* wordMask) {
+  auto numberOfWords = sampleSize / sizeof(uint64_t);
+  for (size_t column = 0; column < numberOfWords; column++) {
+    // words are independent of each other
+    if (wordMask != nullptr && (column >= wordMask->size() || !(*wordMask)[column])) {
+      continue;
+    }
+    auto plane = encoded + column * sizeof(uint64_t) * sampleCount;
+    uint64_t word = 0;
+    for (size_t row = 0; row < sampleCount; row++) {
+      // gather bytes from their planes and undo the xor
+      uint64_t delta = 0;
+      for (size_t byte = 0; byte < sizeof(uint64_t); byte++) {
+        delta |= static_cast<uint64_t>(plane[byte * sampleCount + row]) << (8 * byte);
+      }
+      word ^= delta;
+      memcpy(samples + row * sampleSize + column * sizeof(uint64_t), &word, sizeof(uint64_t));
+    }
+  }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Columnar encoding of a block of samples. Each sample is treated as a row of 64 bit words. Every word is xor-ed with
+// the same word of the previous sample and its eight bytes are scattered into separate byte planes:
+//
+//   plane(column, byte)[row] = byte of (word[row][column] ^ word[row - 1][column])
+//
+// Slowly changing doubles share sign, exponent and upper mantissa with their predecessor, so most planes become
+// runs of zeros that deflate compresses at very low cost. The first sample of a block is xor-ed with zero, which
+// keeps blocks independent of each other.
+class FlightDataRecorderColumnarBlock {
+ public:
+  void initialize(size_t sampleSize, size_t capacity);
+
+  // adds one sample, the work is done per sample to avoid a spike when the block is complete
+  void add(const void* sample);
+
+  size_t getSampleCount() const;
+  bool isEmpty() const;
+  bool isFull() const;
+
+  // moves the encoded block into the given buffer and starts a new block
+  void finish(std::vector<unsigned char>& encoded);
+
+  // reverses the encoding of a block with the given number of samples, if a word mask is given only the words set in
+  // it are decoded and all other bytes of the samples are left untouched
+  static void decode(const unsigned char* encoded,
+                     size_t sampleSize,
+                     size_t sampleCount,
+                     unsigned char* samples,
+                     const std::vector<bool>* wordMask = nullptr);
+
+ private:
+  size_t numberOfWords = 0;
+  size_t capacity = 0;
+  size_t sampleCount = 0;
+
+  std::vector<uint64_t> previous;
+  std::vector<unsigned char> planes;
+};
@@ -0,0 +1,248 @@
+#include "FlightDataRecorderCompressor.h"
+
+#include <algorithm>
+
+#include "FlightDataRecorderFormat.h"
+
+using namespace std;
+
+FlightDataRecorderCompressor::FlightDataRecorderCompressor() : output(2 * SLICE_SIZE) {}
+
+FlightDataRecorderCompressor::~FlightDataRecorderCompressor() {
+  close();
+}
+
+bool FlightDataRecorderCompressor::open(const string& filename, Mode fileMode, int level, int strategy) {
+  // ensure previous file is closed
+  close();
+
+  // open file
+  file = fopen(filename.c_str(), "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  // initialize deflate, stream mode uses the gzip wrapper (window bits + 16) to stay compatible with gzip readers
+  mode = fileMode;
+  stream = {};
+  auto windowBits = mode == Mode::STREAM ? 15 + 16 : 15;
+  if (deflateInit2(&stream, level, Z_DEFLATED, windowBits, 8, strategy) != Z_OK) {
+    fclose(file);
+    file = nullptr;
+    return false;
+  }
+  isStreamInitialized = true;
+
+  // reset buffers
+  pending.clear();
+  pendingOffset = 0;
+  jobs.clear();
+  outstandingJobBytes = 0;
+  compressedChunk.clear();
+  chunkLocations.clear();
+  bytesQueued = 0;
+  bytesWritten = 0;
+
+  return true;
+}
+
+bool FlightDataRecorderCompressor::isOpen() const {
+  return file != nullptr;
+}
+
+void FlightDataRecorderCompressor::close() {
+  if (file == nullptr) {
+    return;
+  }
+
+  if (mode == Mode::STREAM) {
+    // compress everything that is outstanding and finish the stream
+    deflateAndWrite(pending.data() + pendingOffset, pending.size() - pendingOffset, Z_FINISH);
+    pending.clear();
+    pendingOffset = 0;
+  } else {
+    // process all remaining chunks
+    processJobs(chrono::high_resolution_clock::now(), chrono::microseconds::zero());
+  }
+
+  // release resources
+  if (isStreamInitialized) {
+    deflateEnd(&stream);
+    isStreamInitialized = false;
+  }
+  fclose(file);
+  file = nullptr;
+}
+
+void FlightDataRecorderCompressor::queue(const void* data, size_t size) {
+  auto bytes = static_cast<const unsigned char*>(data);
+  bytesQueued += size;
+
+  if (mode == Mode::CHUNKED) {
+    jobs.push_back({false, 0, false, {}, vector<unsigned char>(bytes, bytes + size), 0});
+    outstandingJobBytes += size;
+    return;
+  }
+
+  // compact buffer when more than half of it was already consumed
+  if (pendingOffset > 0 && pendingOffset >= pending.size() / 2) {
+    pending.erase(pending.begin(), pending.begin() + pendingOffset);
+    pendingOffset = 0;
+  }
+
+  pending.insert(pending.end(), bytes, bytes + size);
+}
+
+void FlightDataRecorderCompressor::queueChunk(uint32_t type, vector<unsigned char> prefix, vector<unsigned char> data, bool compress) {
+  outstandingJobBytes += prefix.size() + data.size();
+  bytesQueued += prefix.size() + data.size();
+  jobs.push_back({true, type, compress, std::move(prefix), std::move(data), 0});
+}
+
+size_t FlightDataRecorderCompressor::process(chrono::microseconds budget) {
+  if (file == nullptr) {
+    return 0;
+  }
+
+  auto start = chrono::high_resolution_clock::now();
+  if (mode == Mode::STREAM) {
+    return processStream(start, budget);
+  }
+  return processJobs(start, budget);
+}
+
+size_t FlightDataRecorderCompressor::getOutstandingBytes() const {
+  return (pending.size() - pendingOffset) + outstandingJobBytes;
+}
+
+int FlightDataRecorderCompressor::getStrategy(const string& name) {
+  if (name == "FILTERED") {
+    return Z_FILTERED;
+  } else if (name == "RLE") {
+    return Z_RLE;
+  } else if (name == "HUFFMAN_ONLY") {
+    return Z_HUFFMAN_ONLY;
+  } else if (name == "FIXED") {
+    return Z_FIXED;
+  }
+  return Z_DEFAULT_STRATEGY;
+}
+
+uint64_t FlightDataRecorderCompressor::getBytesQueued() const {
+  return bytesQueued;
+}
+
+uint64_t FlightDataRecorderCompressor::getBytesWritten() const {
+  return bytesWritten;
+}
+
+const vector<FlightDataRecorderCompressor::ChunkLocation>& FlightDataRecorderCompressor::getChunkLocations() const {
+  return chunkLocations;
+}
+
+size_t FlightDataRecorderCompressor::processStream(chrono::high_resolution_clock::time_point start, chrono::microseconds budget) {
+  size_t processed = 0;
+
+  while (pendingOffset < pending.size()) {
+    // compress one slice
+    auto size = min(SLICE_SIZE, pending.size() - pendingOffset);
+    deflateAndWrite(pending.data() + pendingOffset, size, Z_NO_FLUSH);
+    pendingOffset += size;
+    processed += size;
+
+    // check if budget is used up
+    if (budget.count() > 0 && chrono::high_resolution_clock::now() - start >= budget) {
+      break;
+    }
+  }
+
+  // everything was processed -> release consumed data
+  if (pendingOffset == pending.size()) {
+    pending.clear();
+    pendingOffset = 0;
+  }
+
+  return processed;
+}
+
+size_t FlightDataRecorderCompressor::processJobs(chrono::high_resolution_clock::time_point start, chrono::microseconds budget) {
+  size_t processed = 0;
+
+  while (!jobs.empty()) {
+    auto& job = jobs.front();
+
+    if (job.compress) {
+      // compress one slice, the last slice finishes the stream of this chunk
+      auto size = min(SLICE_SIZE, job.data.size() - job.offset);
+      auto isLastSlice = job.offset + size == job.data.size();
+      deflateAndAppend(job.data.data() + job.offset, size, isLastSlice ? Z_FINISH : Z_NO_FLUSH, compressedChunk);
+      job.offset += size;
+      processed += size;
+      outstandingJobBytes -= size;
+
+      if (isLastSlice) {
+        outstandingJobBytes -= job.prefix.size();
+        writeJob(job);
+        compressedChunk.clear();
+        deflateReset(&stream);
+        jobs.pop_front();
+      }
+    } else {
+      // uncompressed data is written at once
+      outstandingJobBytes -= job.prefix.size() + job.data.size();
+      processed += job.prefix.size() + job.data.size();
+      writeJob(job);
+      jobs.pop_front();
+    }
+
+    // check if budget is used up
+    if (budget.count() > 0 && chrono::high_resolution_clock::now() - start >= budget) {
+      break;
+    }
+  }
+
+  return processed;
+}
+
+void FlightDataRecorderCompressor::writeJob(const Job& job) {
+  const auto& payload = job.compress ? compressedChunk : job.data;
+
+  if (job.isChunk) {
+    chunkLocations.push_back({job.chunkType, bytesWritten});
+    FlightDataRecorderFormat::ChunkHeader header = {job.chunkType, static_cast<uint32_t>(job.prefix.size() + payload.size())};
+    write(&header, sizeof(header));
+    write(job.prefix.data(), job.prefix.size());
+  }
+  write(payload.data(), payload.size());
+}
+
+void FlightDataRecorderCompressor::write(const void* data, size_t size) {
+  fwrite(data, 1, size, file);
+  bytesWritten += size;
+}
+
+void FlightDataRecorderCompressor::deflateAndWrite(const unsigned char* data, size_t size, int flush) {
+  stream.next_in = const_cast<Bytef*>(data);
+  stream.avail_in = static_cast<uInt>(size);
+
+  // run deflate until all input is consumed and the output buffer was not filled completely
+  do {
+    stream.next_out = output.data();
+    stream.avail_out = static_cast<uInt>(output.size());
+    deflate(&stream, flush);
+    write(output.data(), output.size() - stream.avail_out);
+  } while (stream.avail_out == 0);
+}
+
+void FlightDataRecorderCompressor::deflateAndAppend(const unsigned char* data, size_t size, int flush, vector<unsigned char>& target) {
+  stream.next_in = const_cast<Bytef*>(data);
+  stream.avail_in = static_cast<uInt>(size);
+
+  // run deflate until all input is consumed and the output buffer was not filled completely
+  do {
+    stream.next_out = output.data();
+    stream.avail_out = static_cast<uInt>(output.size());
+    deflate(&stream, flush);
+    target.insert(target.end(), output.data(), output.data() + (output.size() - stream.avail_out));
+  } while (stream.avail_out == 0);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "zlib.h"
+
+// File writer that separates buffering from compression. Data is queued and deflated in slices by process(), which
+// stops as soon as the given time budget is used up. Work that did not fit into the budget stays queued and is
+// continued by the next call.
+//
+// In stream mode all queued data forms one gzip stream (legacy file format). In chunked mode every chunk is
+// compressed on its own and written with a chunk header once it is complete.
+class FlightDataRecorderCompressor {
+ public:
+  // size of the raw data fed into deflate at once, the time budget is checked after each slice
+  static constexpr size_t SLICE_SIZE = 1024;
+
+  enum class Mode {
+    STREAM,
+    CHUNKED,
+  };
+
+  FlightDataRecorderCompressor();
+  ~FlightDataRecorderCompressor();
+
+  // level and strategy are passed to deflate
+  bool open(const std::string& filename, Mode mode, int level = Z_DEFAULT_COMPRESSION, int strategy = Z_DEFAULT_STRATEGY);
+  bool isOpen() const;
+
+  // compresses all outstanding data, finishes the last stream and closes the file
+  void close();
+
+  // stream mode: appends data to the gzip stream, chunked mode: writes data uncompressed
+  void queue(const void* data, size_t size);
+
+  // chunked mode: writes chunk header, the uncompressed prefix and the (optionally compressed) data
+  void queueChunk(uint32_t type, std::vector<unsigned char> prefix, std::vector<unsigned char> data, bool compress);
+
+  // compresses queued data until the budget is used up, a budget of zero means unlimited
+  size_t process(std::chrono::microseconds budget);
+
+  size_t getOutstandingBytes() const;
+
+  // converts a strategy name (DEFAULT, FILTERED, RLE, HUFFMAN_ONLY, FIXED) into the deflate strategy
+  static int getStrategy(const std::string& name);
+
+  // number of uncompressed bytes queued and number of bytes written to the file so far
+  uint64_t getBytesQueued() const;
+  uint64_t getBytesWritten() const;
+
+  // chunked mode: file offsets of the chunks written so far
+  struct ChunkLocation {
+    uint32_t type;
+    uint64_t offset;
+  };
+  const std::vector<ChunkLocation>& getChunkLocations() const;
+
+ private:
+  struct Job {
+    bool isChunk;
+    uint32_t chunkType;
+    bool compress;
+    std::vector<unsigned char> prefix;
+    std::vector<unsigned char> data;
+    size_t offset;
+  };
+
+  Mode mode = Mode::STREAM;
+  FILE* file = nullptr;
+  z_stream stream = {};
+  bool isStreamInitialized = false;
+
+  // stream mode
+  std::vector<unsigned char> pending;
+  size_t pendingOffset = 0;
+
+  // chunked mode
+  std::deque<Job> jobs;
+  size_t outstandingJobBytes = 0;
+  std::vector<unsigned char> compressedChunk;
+  std::vector<ChunkLocation> chunkLocations;
+  // atomic to allow reading statistics from another thread
+  std::atomic<uint64_t> bytesQueued = 0;
+  std::atomic<uint64_t> bytesWritten = 0;
+
+  std::vector<unsigned char> output;
+
+  size_t processStream(std::chrono::high_resolution_clock::time_point start, std::chrono::microseconds budget);
+  size_t processJobs(std::chrono::high_resolution_clock::time_point start, std::chrono::microseconds budget);
+
+  void writeJob(const Job& job);
+  void write(const void* data, size_t size);
+
+  void deflateAndWrite(const unsigned char* data, size_t size, int flush);
+  void deflateAndAppend(const unsigned char* data, size_t size, int flush, std::vector<unsigned char>& target);
+};
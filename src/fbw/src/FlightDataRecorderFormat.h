@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+
+// Block based file format of the flight data recorder.
+//
+//   file  := FileHeader schema chunk* [index trailer]
+//   chunk := ChunkHeader payload
+//
+// The schema chunk follows the file header and contains a SchemaHeader and the zlib compressed field list of
+// FlightDataRecorderSchema (path, type, offset and size of every field). It allows to decode a file without knowing
+// the struct layout of the interface version that wrote it.
+//
+// A block chunk contains a BlockHeader followed by the encoded samples of the block, zlib compressed unless the
+// header says otherwise. Each block is compressed on its own, so a reader can start decoding at any block. Readers
+// skip chunk types they do not know.
+//
+// When a file is closed regularly, an index chunk with one IndexEntry per block, a statistics chunk with the cost of
+// recording the file and a trailer chunk pointing to the index are appended. The trailer has a fixed size and is
+// always the last chunk, so a reader can locate the index from the end of the file and jump to a time range without
+// inflating the blocks before it.
+//
+// Legacy files (format version 1) are a single gzip stream containing the interface version followed by the raw
+// samples. They are distinguished by the magic at the start of the file.
+class FlightDataRecorderFormat {
+ public:
+  FlightDataRecorderFormat() = delete;
+
+  static constexpr uint32_t FORMAT_VERSION_LEGACY = 1;
+  static constexpr uint32_t FORMAT_VERSION = 2;
+
+  static constexpr char MAGIC[8] = {'F', 'B', 'W', 'F', 'D', 'R', 'B', 'K'};
+
+  enum ChunkType : uint32_t {
+    CHUNK_TYPE_BLOCK = 1,
+    CHUNK_TYPE_INDEX = 2,
+    CHUNK_TYPE_TRAILER = 3,
+    CHUNK_TYPE_SCHEMA = 4,
+    CHUNK_TYPE_STATISTICS = 5,
+  };
+
+  enum BlockEncoding : uint32_t {
+    // samples stored back to back
+    BLOCK_ENCODING_ROWS = 0,
+    // samples split into 64 bit columns, xor with previous value and transposed into byte planes
+    BLOCK_ENCODING_COLUMNAR = 1,
+    // per sample change mask followed by the changed fields, see FlightDataRecorderSparseBlock
+    BLOCK_ENCODING_SPARSE = 2,
+  };
+
+  enum BlockCompression : uint32_t {
+    BLOCK_COMPRESSION_DEFLATE = 0,
+    BLOCK_COMPRESSION_NONE = 1,
+  };
+
+  struct FileHeader {
+    char magic[8];
+    uint32_t formatVersion;
+    uint32_t sampleSize;
+    uint64_t interfaceVersion;
+    uint32_t samplesPerBlock;
+    uint32_t reserved;
+  };
+
+  struct ChunkHeader {
+    uint32_t type;
+    // size of the payload following the chunk header
+    uint32_t size;
+  };
+
+  struct SchemaHeader {
+    uint32_t fieldCount;
+    uint32_t uncompressedSize;
+  };
+
+  struct BlockHeader {
+    uint32_t encoding;
+    uint32_t sampleCount;
+    // size of the encoded block before compression
+    uint32_t uncompressedSize;
+    uint32_t compression;
+    double firstSimulationTime;
+    double lastSimulationTime;
+  };
+
+  struct IndexEntry {
+    // offset of the chunk header of the block from the start of the file
+    uint64_t offset;
+    uint64_t firstSampleIndex;
+    uint32_t sampleCount;
+    uint32_t reserved;
+    double firstSimulationTime;
+    double lastSimulationTime;
+  };
+
+  // bucket i counts durations of less than 2^i ns (and at least 2^(i-1) ns), the last bucket also counts longer ones
+  static constexpr uint32_t HISTOGRAM_BUCKETS = 32;
+
+  struct Histogram {
+    uint64_t count;
+    uint64_t totalNanoseconds;
+    uint64_t maximumNanoseconds;
+    uint64_t buckets[HISTOGRAM_BUCKETS];
+  };
+
+  struct Statistics {
+    uint64_t sampleCount;
+    // uncompressed bytes queued for the file and bytes written to it, without the statistics and following chunks
+    uint64_t bytesIn;
+    uint64_t bytesOut;
+    // duration of the update calls while the file was written
+    Histogram updateTime;
+    // duration of closing the previous file and opening this one
+    Histogram rotationTime;
+  };
+
+  struct Trailer {
+    ChunkHeader header;
+    uint64_t indexOffset;
+  };
+};
+
+static_assert(sizeof(FlightDataRecorderFormat::FileHeader) == 32, "unexpected size of file header");
+static_assert(sizeof(FlightDataRecorderFormat::ChunkHeader) == 8, "unexpected size of chunk header");
+static_assert(sizeof(FlightDataRecorderFormat::SchemaHeader) == 8, "unexpected size of schema header");
+static_assert(sizeof(FlightDataRecorderFormat::BlockHeader) == 32, "unexpected size of block header");
+static_assert(sizeof(FlightDataRecorderFormat::IndexEntry) == 40, "unexpected size of index entry");
+static_assert(sizeof(FlightDataRecorderFormat::Statistics) == 24 + 2 * 280, "unexpected size of statistics");
+static_assert(sizeof(FlightDataRecorderFormat::Trailer) == 16, "unexpected size of trailer");
@@ -0,0 +1,148 @@
+#include "FlightDataRecorderManifest.h"
+
+#include <dirent.h>
+#include <stdio.h>
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+// one line per file: size sample-count first-simulation-time last-simulation-time filename
+
+void FlightDataRecorderManifest::load(const string& manifestFilePath, const string& directoryPath, const string& extension) {
+  filePath = manifestFilePath;
+  directory = directoryPath;
+  entries.clear();
+  totalSize = 0;
+
+  // read manifest
+  ifstream in(filePath);
+  if (!in.is_open()) {
+    // first start -> adopt existing files once
+    scanDirectory(extension);
+    save();
+    return;
+  }
+
+  Entry entry = {};
+  while (in >> entry.size >> entry.sampleCount >> entry.firstSimulationTime >> entry.lastSimulationTime) {
+    in >> ws;
+    getline(in, entry.filename);
+    if (!entry.filename.empty()) {
+      addEntry(entry);
+    }
+  }
+}
+
+void FlightDataRecorderManifest::add(const string& filename) {
+  addEntry({filename, 0, 0, 0, 0});
+}
+
+bool FlightDataRecorderManifest::contains(const string& filename) const {
+  return any_of(entries.begin(), entries.end(), [&filename](const Entry& entry) { return entry.filename == filename; });
+}
+
+void FlightDataRecorderManifest::updateNewest(uint64_t size, uint64_t sampleCount, double firstSimulationTime, double lastSimulationTime) {
+  if (entries.empty()) {
+    return;
+  }
+
+  auto& entry = entries.back();
+  totalSize = totalSize - entry.size + size;
+  entry.size = size;
+  entry.sampleCount = sampleCount;
+  entry.firstSimulationTime = firstSimulationTime;
+  entry.lastSimulationTime = lastSimulationTime;
+}
+
+void FlightDataRecorderManifest::applyRetention(size_t maximumNumberOfFiles, uint64_t maximumTotalSize) {
+  while (entries.size() > 1 && ((maximumNumberOfFiles > 0 && entries.size() > maximumNumberOfFiles) ||
+                                (maximumTotalSize > 0 && totalSize > maximumTotalSize))) {
+    // a file that was removed manually is simply dropped from the manifest, the file being written is kept even if an
+    // older entry has its name
+    if (entries.front().filename != entries.back().filename) {
+      remove(entries.front().filename.c_str());
+    }
+    totalSize -= entries.front().size;
+    entries.pop_front();
+  }
+}
+
+bool FlightDataRecorderManifest::save() const {
+  ofstream out(filePath, ios::out | ios::trunc);
+  if (!out.is_open()) {
+    return false;
+  }
+
+  out << setprecision(numeric_limits<double>::max_digits10);
+  for (const auto& entry : entries) {
+    out << entry.size << " " << entry.sampleCount << " " << entry.firstSimulationTime << " " << entry.lastSimulationTime << " "
+        << entry.filename << "\n";
+  }
+  return out.good();
+}
+
+size_t FlightDataRecorderManifest::getNumberOfFiles() const {
+  return entries.size();
+}
+
+uint64_t FlightDataRecorderManifest::getTotalSize() const {
+  return totalSize;
+}
+
+void FlightDataRecorderManifest::addEntry(const Entry& entry) {
+  // a reused name refers to the new file, the old one was overwritten (manifests of earlier versions may list it twice)
+  auto existing = find_if(entries.begin(), entries.end(), [&entry](const Entry& other) { return other.filename == entry.filename; });
+  if (existing != entries.end()) {
+    totalSize -= existing->size;
+    entries.erase(existing);
+  }
+
+  totalSize += entry.size;
+  entries.push_back(entry);
+}
+
+void FlightDataRecorderManifest::scanDirectory(const string& extension) {
+  // collect files with the right extension
+  vector<string> files;
+  DIR* dir = opendir(directory.c_str());
+  if (dir == nullptr) {
+    return;
+  }
+  struct dirent* directoryEntry;
+  while ((directoryEntry = readdir(dir)) != NULL) {
+    string filename = directoryEntry->d_name;
+    if (filename.length() > extension.length() &&
+        filename.compare(filename.length() - extension.length(), extension.length(), extension) == 0) {
+      files.push_back(filename);
+    }
+  }
+  closedir(dir);
+
+  // filenames contain the creation time and a counter for files of the same second -> sorting by time, then by the
+  // length of the counter and the counter itself sorts by age
+  static constexpr size_t TIME_LENGTH = sizeof("YYYY-mm-dd-HH-MM-SS") - 1;
+  sort(files.begin(), files.end(), [](const string& a, const string& b) {
+    auto timeComparison = a.compare(0, TIME_LENGTH, b, 0, TIME_LENGTH);
+    if (timeComparison != 0) {
+      return timeComparison < 0;
+    }
+    return a.length() != b.length() ? a.length() < b.length() : a < b;
+  });
+
+  // sample count and time span of adopted files are unknown
+  for (const auto& filename : files) {
+    Entry entry = {directory + "\\" + filename, 0, 0, 0, 0};
+    FILE* file = fopen(entry.filename.c_str(), "rb");
+    if (file != nullptr) {
+      fseek(file, 0, SEEK_END);
+      entry.size = static_cast<uint64_t>(max(ftell(file), 0L));
+      fclose(file);
+    }
+    totalSize += entry.size;
+    entries.push_back(entry);
+  }
+}
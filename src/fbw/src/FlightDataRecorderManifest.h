@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+
+// List of the files written by the flight data recorder, oldest first. It is persisted next to the files and rewritten
+// when a file is opened and when it is closed, so retention only looks at the oldest entries instead of listing and
+// sorting the directory. Lookups by name and saving are linear in the number of kept files. The directory is
+// only scanned once when no manifest exists yet, to adopt files of earlier versions.
+class FlightDataRecorderManifest {
+ public:
+  struct Entry {
+    std::string filename;
+    uint64_t size;
+    uint64_t sampleCount;
+    double firstSimulationTime;
+    double lastSimulationTime;
+  };
+
+  // reads the manifest or creates it from the files in the directory
+  void load(const std::string& manifestFilePath, const std::string& directory, const std::string& extension);
+
+  // adds a new file as newest entry, an entry with the same name is replaced
+  void add(const std::string& filename);
+
+  bool contains(const std::string& filename) const;
+
+  // updates size, sample count and time span of the newest entry
+  void updateNewest(uint64_t size, uint64_t sampleCount, double firstSimulationTime, double lastSimulationTime);
+
+  // removes the oldest files until the limits are met, the newest file (the one being written) is never removed, a
+  // limit of zero is ignored
+  void applyRetention(size_t maximumNumberOfFiles, uint64_t maximumTotalSize);
+
+  bool save() const;
+
+  size_t getNumberOfFiles() const;
+  uint64_t getTotalSize() const;
+
+ private:
+  std::string filePath;
+  std::string directory;
+  std::deque<Entry> entries;
+  uint64_t totalSize = 0;
+
+  void addEntry(const Entry& entry);
+  void scanDirectory(const std::string& extension);
+};
@@ -0,0 +1,65 @@
+#include "FlightDataRecorderRingBuffer.h"
+
+void FlightDataRecorderRingBuffer::initialize(size_t numberOfSlots) {
+  slots.assign(numberOfSlots > 0 ? numberOfSlots : 1, FlightDataRecorderSample{});
+  writeCounter = 0;
+  readCounter = 0;
+  droppedSamples = 0;
+  highWaterMark = 0;
+}
+
+FlightDataRecorderSample* FlightDataRecorderRingBuffer::beginWrite() {
+  auto write = writeCounter.load(std::memory_order_relaxed);
+  auto read = readCounter.load(std::memory_order_acquire);
+
+  // check if there is a free slot
+  if (write - read >= slots.size()) {
+    droppedSamples.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  return &slots[write % slots.size()];
+}
+
+void FlightDataRecorderRingBuffer::endWrite() {
+  auto write = writeCounter.load(std::memory_order_relaxed) + 1;
+  writeCounter.store(write, std::memory_order_release);
+
+  // remember the maximum fill level
+  auto size = static_cast<size_t>(write - readCounter.load(std::memory_order_acquire));
+  if (size > highWaterMark.load(std::memory_order_relaxed)) {
+    highWaterMark.store(size, std::memory_order_relaxed);
+  }
+}
+
+const FlightDataRecorderSample* FlightDataRecorderRingBuffer::beginRead() {
+  auto read = readCounter.load(std::memory_order_relaxed);
+  auto write = writeCounter.load(std::memory_order_acquire);
+
+  // check if there is a filled slot
+  if (read == write) {
+    return nullptr;
+  }
+
+  return &slots[read % slots.size()];
+}
+
+void FlightDataRecorderRingBuffer::endRead() {
+  readCounter.store(readCounter.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+size_t FlightDataRecorderRingBuffer::getSize() const {
+  return static_cast<size_t>(writeCounter.load(std::memory_order_acquire) - readCounter.load(std::memory_order_acquire));
+}
+
+size_t FlightDataRecorderRingBuffer::getCapacity() const {
+  return slots.size();
+}
+
+uint64_t FlightDataRecorderRingBuffer::getDroppedSamples() const {
+  return droppedSamples.load(std::memory_order_relaxed);
+}
+
+size_t FlightDataRecorderRingBuffer::getHighWaterMark() const {
+  return highWaterMark.load(std::memory_order_relaxed);
+}
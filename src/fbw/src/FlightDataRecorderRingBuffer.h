@@ -0,0 +1,39 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FlightDataRecorderSample.h"
+
+// Preallocated single producer / single consumer ring of sample slots. The producer (gauge update) only copies the
+// recorded structs into a free slot, the consumer (writer stage) compresses and writes them to the file. If the
+// consumer falls behind, new samples are dropped instead of blocking the producer.
+class FlightDataRecorderRingBuffer {
+ public:
+  void initialize(size_t numberOfSlots);
+
+  // returns a free slot or nullptr if the buffer is full (the sample is counted as dropped)
+  FlightDataRecorderSample* beginWrite();
+  void endWrite();
+
+  // returns the oldest filled slot or nullptr if the buffer is empty
+  const FlightDataRecorderSample* beginRead();
+  void endRead();
+
+  size_t getSize() const;
+  size_t getCapacity() const;
+  uint64_t getDroppedSamples() const;
+  size_t getHighWaterMark() const;
+
+ private:
+  std::vector<FlightDataRecorderSample> slots;
+
+  // monotonic counters, the slot index is the counter modulo the capacity
+  std::atomic<uint64_t> writeCounter = 0;
+  std::atomic<uint64_t> readCounter = 0;
+
+  std::atomic<uint64_t> droppedSamples = 0;
+  std::atomic<size_t> highWaterMark = 0;
+};
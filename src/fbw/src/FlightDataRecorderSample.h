@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#include "AutopilotLaws_types.h"
+#include "AutopilotStateMachine_types.h"
+#include "Autothrust_types.h"
+#include "EngineData.h"
+#include "FlyByWire_types.h"
+
+// One entry of the flight data recorder. The memory layout is identical to the five structs written back to back,
+// so a sample can be written to and read from a file with a single call.
+struct FlightDataRecorderSample {
+  ap_sm_output ap_sm;
+  ap_raw_output ap_law;
+  athr_out athr;
+  fbw_output fbw;
+  EngineData engine;
+};
+
+static_assert(sizeof(FlightDataRecorderSample) ==
+                  sizeof(ap_sm_output) + sizeof(ap_raw_output) + sizeof(athr_out) + sizeof(fbw_output) + sizeof(EngineData),
+              "FlightDataRecorderSample must not contain padding between the recorded structs");
+
+static_assert(sizeof(FlightDataRecorderSample) % sizeof(uint64_t) == 0,
+              "FlightDataRecorderSample must consist of 64 bit words for the columnar block encoding");
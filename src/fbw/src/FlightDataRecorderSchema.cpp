@@ -0,0 +1,151 @@
+#include "FlightDataRecorderSchema.h"
+
+#include <cstring>
+
+using namespace std;
+
+// serialized entry: offset (uint32), size (uint32), type (uint8), path length (uint16), path
+
+template <typename T>
+static void append(vector<unsigned char>& data, T value) {
+  auto bytes = reinterpret_cast<const unsigned char*>(&value);
+  data.insert(data.end(), bytes, bytes + sizeof(value));
+}
+
+template <typename T>
+static bool extract(const unsigned char* data, size_t size, size_t& position, T& value) {
+  if (position + sizeof(value) > size) {
+    return false;
+  }
+  memcpy(&value, data + position, sizeof(value));
+  position += sizeof(value);
+  return true;
+}
+
+void FlightDataRecorderSchema::serialize(const vector<Field>& fields, vector<unsigned char>& data) {
+  append(data, static_cast<uint32_t>(fields.size()));
+  for (const auto& field : fields) {
+    append(data, field.offset);
+    append(data, field.size);
+    append(data, static_cast<uint8_t>(field.type));
+    append(data, static_cast<uint16_t>(field.path.size()));
+    data.insert(data.end(), field.path.begin(), field.path.end());
+  }
+}
+
+bool FlightDataRecorderSchema::deserialize(const unsigned char* data, size_t size, vector<Field>& fields) {
+  size_t position = 0;
+  uint32_t numberOfFields = 0;
+  if (!extract(data, size, position, numberOfFields)) {
+    return false;
+  }
+
+  fields.clear();
+  fields.reserve(numberOfFields);
+  for (uint32_t i = 0; i < numberOfFields; i++) {
+    Field field = {};
+    uint8_t type = 0;
+    uint16_t pathLength = 0;
+    if (!extract(data, size, position, field.offset) || !extract(data, size, position, field.size) ||
+        !extract(data, size, position, type) || !extract(data, size, position, pathLength) || position + pathLength > size) {
+      return false;
+    }
+    field.type = static_cast<FieldType>(type);
+    field.path.assign(reinterpret_cast<const char*>(data + position), pathLength);
+    position += pathLength;
+    fields.push_back(std::move(field));
+  }
+
+  return true;
+}
+
+const FlightDataRecorderSchema::Field* FlightDataRecorderSchema::find(const vector<Field>& fields, const string& path) {
+  for (const auto& field : fields) {
+    if (field.path == path) {
+      return &field;
+    }
+  }
+  return nullptr;
+}
+
+bool FlightDataRecorderSchema::matches(const string& pattern, const string& path) {
+  // iterative matching with backtracking to the last star
+  size_t p = 0;
+  size_t s = 0;
+  size_t star = string::npos;
+  size_t starMatch = 0;
+  while (s < path.size()) {
+    if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == path[s])) {
+      p++;
+      s++;
+    } else if (p < pattern.size() && pattern[p] == '*') {
+      star = p++;
+      starMatch = s;
+    } else if (star != string::npos) {
+      p = star + 1;
+      s = ++starMatch;
+    } else {
+      return false;
+    }
+  }
+  while (p < pattern.size() && pattern[p] == '*') {
+    p++;
+  }
+  return p == pattern.size();
+}
+
+double FlightDataRecorderSchema::getValue(const Field& field, const unsigned char* sample) {
+  // memcpy avoids unaligned access
+  switch (field.type) {
+    case FIELD_TYPE_REAL: {
+      double value;
+      memcpy(&value, sample + field.offset, sizeof(value));
+      return value;
+    }
+    case FIELD_TYPE_BOOLEAN:
+      return sample[field.offset];
+    case FIELD_TYPE_INT32: {
+      int32_t value;
+      memcpy(&value, sample + field.offset, sizeof(value));
+      return value;
+    }
+    case FIELD_TYPE_UINT32: {
+      uint32_t value;
+      memcpy(&value, sample + field.offset, sizeof(value));
+      return value;
+    }
+    case FIELD_TYPE_UINT64: {
+      uint64_t value;
+      memcpy(&value, sample + field.offset, sizeof(value));
+      return static_cast<double>(value);
+    }
+  }
+  return 0;
+}
+
+void FlightDataRecorderSchema::setValue(const Field& field, unsigned char* sample, double value) {
+  // memcpy avoids unaligned access
+  switch (field.type) {
+    case FIELD_TYPE_REAL:
+      memcpy(sample + field.offset, &value, sizeof(value));
+      break;
+    case FIELD_TYPE_BOOLEAN:
+      sample[field.offset] = value != 0 ? 1 : 0;
+      break;
+    case FIELD_TYPE_INT32: {
+      auto typedValue = static_cast<int32_t>(value);
+      memcpy(sample + field.offset, &typedValue, sizeof(typedValue));
+      break;
+    }
+    case FIELD_TYPE_UINT32: {
+      auto typedValue = static_cast<uint32_t>(value);
+      memcpy(sample + field.offset, &typedValue, sizeof(typedValue));
+      break;
+    }
+    case FIELD_TYPE_UINT64: {
+      auto typedValue = static_cast<uint64_t>(value);
+      memcpy(sample + field.offset, &typedValue, sizeof(typedValue));
+      break;
+    }
+  }
+}
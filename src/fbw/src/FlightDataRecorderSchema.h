@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "FlightDataRecorderSample.h"
+
+// Description of every field of a recorded sample (path, type, offset and size). The recorder writes it into a
+// schema chunk at the start of each file, so readers can decode files of any interface version without being
+// compiled against the matching struct layout.
+class FlightDataRecorderSchema {
+ public:
+  FlightDataRecorderSchema() = delete;
+
+  enum FieldType : uint8_t {
+    FIELD_TYPE_REAL = 0,
+    FIELD_TYPE_BOOLEAN = 1,
+    FIELD_TYPE_INT32 = 2,
+    FIELD_TYPE_UINT32 = 3,
+    FIELD_TYPE_UINT64 = 4,
+  };
+
+  struct Field {
+    std::string path;
+    FieldType type;
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  // fields of FlightDataRecorderSample, see FlightDataRecorderSchema_data.cpp
+  static const std::vector<Field>& getFields();
+
+  static void serialize(const std::vector<Field>& fields, std::vector<unsigned char>& data);
+  static bool deserialize(const unsigned char* data, size_t size, std::vector<Field>& fields);
+
+  // returns the field with the given path or nullptr
+  static const Field* find(const std::vector<Field>& fields, const std::string& path);
+
+  // returns true if the path matches the pattern, '*' matches any sequence of characters and '?' a single one
+  static bool matches(const std::string& pattern, const std::string& path);
+
+  // reads a field of any type from a sample as double
+  static double getValue(const Field& field, const unsigned char* sample);
+
+  // writes a value into a field of any type, converted like a cast
+  static void setValue(const Field& field, unsigned char* sample, double value);
+
+  template <typename T>
+  static Field makeField(const char* path, size_t offset) {
+    using Type = std::remove_cv_t<std::remove_reference_t<T>>;
+    return {path, getFieldType<Type>(), static_cast<uint32_t>(offset), static_cast<uint32_t>(sizeof(Type))};
+  }
+
+ private:
+  template <typename T>
+  static constexpr FieldType getFieldType() {
+    if constexpr (std::is_floating_point_v<T>) {
+      static_assert(sizeof(T) == sizeof(double), "only double precision is supported");
+      return FIELD_TYPE_REAL;
+    } else if constexpr (sizeof(T) == 1) {
+      return FIELD_TYPE_BOOLEAN;
+    } else if constexpr (sizeof(T) == 8) {
+      return FIELD_TYPE_UINT64;
+    } else if constexpr (std::is_enum_v<T> || std::is_signed_v<T>) {
+      static_assert(sizeof(T) == 4, "unsupported field size");
+      return FIELD_TYPE_INT32;
+    } else {
+      static_assert(sizeof(T) == 4, "unsupported field size");
+      return FIELD_TYPE_UINT32;
+    }
+  }
+};
@@ -0,0 +1,525 @@
+// generated by scripts/generate_flight_data_recorder_schema.py from the model *_types.h structs, do not edit
+
+#include "FlightDataRecorderSchema.h"
+
+#define FIELD(path) FlightDataRecorderSchema::makeField<decltype(std::declval<FlightDataRecorderSample&>().path)>(#path, offsetof(FlightDataRecorderSample, path))
+
+const std::vector<FlightDataRecorderSchema::Field>& FlightDataRecorderSchema::getFields() {
+  static const std::vector<Field> fields = {
+      FIELD(ap_sm.time.dt),
+      FIELD(ap_sm.time.simulation_time),
+      FIELD(ap_sm.data.aircraft_position.lat),
+      FIELD(ap_sm.data.aircraft_position.lon),
+      FIELD(ap_sm.data.aircraft_position.alt),
+      FIELD(ap_sm.data.Theta_deg),
+      FIELD(ap_sm.data.Phi_deg),
+      FIELD(ap_sm.data.qk_deg_s),
+      FIELD(ap_sm.data.rk_deg_s),
+      FIELD(ap_sm.data.pk_deg_s),
+      FIELD(ap_sm.data.V_ias_kn),
+      FIELD(ap_sm.data.V_tas_kn),
+      FIELD(ap_sm.data.V_mach),
+      FIELD(ap_sm.data.V_gnd_kn),
+      FIELD(ap_sm.data.alpha_deg),
+      FIELD(ap_sm.data.beta_deg),
+      FIELD(ap_sm.data.H_ft),
+      FIELD(ap_sm.data.H_ind_ft),
+      FIELD(ap_sm.data.H_radio_ft),
+      FIELD(ap_sm.data.H_dot_ft_min),
+      FIELD(ap_sm.data.Psi_magnetic_deg),
+      FIELD(ap_sm.data.Psi_magnetic_track_deg),
+      FIELD(ap_sm.data.Psi_true_deg),
+      FIELD(ap_sm.data.ax_m_s2),
+      FIELD(ap_sm.data.ay_m_s2),
+      FIELD(ap_sm.data.az_m_s2),
+      FIELD(ap_sm.data.bx_m_s2),
+      FIELD(ap_sm.data.by_m_s2),
+      FIELD(ap_sm.data.bz_m_s2),
+      FIELD(ap_sm.data.nav_valid),
+      FIELD(ap_sm.data.nav_loc_deg),
+      FIELD(ap_sm.data.nav_gs_deg),
+      FIELD(ap_sm.data.nav_dme_valid),
+      FIELD(ap_sm.data.nav_dme_nmi),
+      FIELD(ap_sm.data.nav_loc_valid),
+      FIELD(ap_sm.data.nav_loc_magvar_deg),
+      FIELD(ap_sm.data.nav_loc_error_deg),
+      FIELD(ap_sm.data.nav_loc_position.lat),
+      FIELD(ap_sm.data.nav_loc_position.lon),
+      FIELD(ap_sm.data.nav_loc_position.alt),
+      FIELD(ap_sm.data.nav_e_loc_valid),
+      FIELD(ap_sm.data.nav_e_loc_error_deg),
+      FIELD(ap_sm.data.nav_gs_valid),
+      FIELD(ap_sm.data.nav_gs_error_deg),
+      FIELD(ap_sm.data.nav_gs_position.lat),
+      FIELD(ap_sm.data.nav_gs_position.lon),
+      FIELD(ap_sm.data.nav_gs_position.alt),
+      FIELD(ap_sm.data.nav_e_gs_valid),
+      FIELD(ap_sm.data.nav_e_gs_error_deg),
+      FIELD(ap_sm.data.flight_guidance_xtk_nmi),
+      FIELD(ap_sm.data.flight_guidance_tae_deg),
+      FIELD(ap_sm.data.flight_guidance_phi_deg),
+      FIELD(ap_sm.data.flight_phase),
+      FIELD(ap_sm.data.V2_kn),
+      FIELD(ap_sm.data.VAPP_kn),
+      FIELD(ap_sm.data.VLS_kn),
+      FIELD(ap_sm.data.VMAX_kn),
+      FIELD(ap_sm.data.is_flight_plan_available),
+      FIELD(ap_sm.data.altitude_constraint_ft),
+      FIELD(ap_sm.data.thrust_reduction_altitude),
+      FIELD(ap_sm.data.thrust_reduction_altitude_go_around),
+      FIELD(ap_sm.data.acceleration_altitude),
+      FIELD(ap_sm.data.acceleration_altitude_engine_out),
+      FIELD(ap_sm.data.acceleration_altitude_go_around),
+      FIELD(ap_sm.data.acceleration_altitude_go_around_engine_out),
+      FIELD(ap_sm.data.cruise_altitude),
+      FIELD(ap_sm.data.on_ground),
+      FIELD(ap_sm.data.zeta_deg),
+      FIELD(ap_sm.data.throttle_lever_1_pos),
+      FIELD(ap_sm.data.throttle_lever_2_pos),
+      FIELD(ap_sm.data.flaps_handle_index),
+      FIELD(ap_sm.data.is_engine_operative_1),
+      FIELD(ap_sm.data.is_engine_operative_2),
+      FIELD(ap_sm.data_computed.time_since_touchdown),
+      FIELD(ap_sm.data_computed.time_since_lift_off),
+      FIELD(ap_sm.data_computed.time_since_SRS),
+      FIELD(ap_sm.data_computed.H_fcu_in_selection),
+      FIELD(ap_sm.data_computed.H_constraint_valid),
+      FIELD(ap_sm.data_computed.Psi_fcu_in_selection),
+      FIELD(ap_sm.data_computed.gs_convergent_towards_beam),
+      FIELD(ap_sm.data_computed.H_dot_radio_fpm),
+      FIELD(ap_sm.data_computed.V_fcu_in_selection),
+      FIELD(ap_sm.data_computed.ALT_soft_mode),
+      FIELD(ap_sm.input.FD_active),
+      FIELD(ap_sm.input.AP_ENGAGE_push),
+      FIELD(ap_sm.input.AP_1_push),
+      FIELD(ap_sm.input.AP_2_push),
+      FIELD(ap_sm.input.AP_DISCONNECT_push),
+      FIELD(ap_sm.input.HDG_push),
+      FIELD(ap_sm.input.HDG_pull),
+      FIELD(ap_sm.input.ALT_push),
+      FIELD(ap_sm.input.ALT_pull),
+      FIELD(ap_sm.input.VS_push),
+      FIELD(ap_sm.input.VS_pull),
+      FIELD(ap_sm.input.LOC_push),
+      FIELD(ap_sm.input.APPR_push),
+      FIELD(ap_sm.input.EXPED_push),
+      FIELD(ap_sm.input.V_fcu_kn),
+      FIELD(ap_sm.input.Psi_fcu_deg),
+      FIELD(ap_sm.input.H_fcu_ft),
+      FIELD(ap_sm.input.H_constraint_ft),
+      FIELD(ap_sm.input.H_dot_fcu_fpm),
+      FIELD(ap_sm.input.FPA_fcu_deg),
+      FIELD(ap_sm.input.TRK_FPA_mode),
+      FIELD(ap_sm.input.DIR_TO_trigger),
+      FIELD(ap_sm.input.is_FLX_active),
+      FIELD(ap_sm.input.Slew_trigger),
+      FIELD(ap_sm.input.MACH_mode),
+      FIELD(ap_sm.input.ATHR_engaged),
+      FIELD(ap_sm.input.is_SPEED_managed),
+      FIELD(ap_sm.input.FDR_event),
+      FIELD(ap_sm.input.Phi_loc_c),
+      FIELD(ap_sm.lateral.armed.NAV),
+      FIELD(ap_sm.lateral.armed.LOC),
+      FIELD(ap_sm.lateral.condition.NAV),
+      FIELD(ap_sm.lateral.condition.LOC_CPT),
+      FIELD(ap_sm.lateral.condition.LOC_TRACK),
+      FIELD(ap_sm.lateral.condition.LAND),
+      FIELD(ap_sm.lateral.condition.FLARE),
+      FIELD(ap_sm.lateral.condition.ROLL_OUT),
+      FIELD(ap_sm.lateral.condition.GA_TRACK),
+      FIELD(ap_sm.lateral.output.mode),
+      FIELD(ap_sm.lateral.output.mode_reversion),
+      FIELD(ap_sm.lateral.output.mode_reversion_TRK_FPA),
+      FIELD(ap_sm.lateral.output.law),
+      FIELD(ap_sm.lateral.output.Psi_c_deg),
+      FIELD(ap_sm.lateral_previous.armed.NAV),
+      FIELD(ap_sm.lateral_previous.armed.LOC),
+      FIELD(ap_sm.lateral_previous.condition.NAV),
+      FIELD(ap_sm.lateral_previous.condition.LOC_CPT),
+      FIELD(ap_sm.lateral_previous.condition.LOC_TRACK),
+      FIELD(ap_sm.lateral_previous.condition.LAND),
+      FIELD(ap_sm.lateral_previous.condition.FLARE),
+      FIELD(ap_sm.lateral_previous.condition.ROLL_OUT),
+      FIELD(ap_sm.lateral_previous.condition.GA_TRACK),
+      FIELD(ap_sm.lateral_previous.output.mode),
+      FIELD(ap_sm.lateral_previous.output.mode_reversion),
+      FIELD(ap_sm.lateral_previous.output.mode_reversion_TRK_FPA),
+      FIELD(ap_sm.lateral_previous.output.law),
+      FIELD(ap_sm.lateral_previous.output.Psi_c_deg),
+      FIELD(ap_sm.vertical.armed.ALT),
+      FIELD(ap_sm.vertical.armed.ALT_CST),
+      FIELD(ap_sm.vertical.armed.CLB),
+      FIELD(ap_sm.vertical.armed.DES),
+      FIELD(ap_sm.vertical.armed.GS),
+      FIELD(ap_sm.vertical.condition.ALT),
+      FIELD(ap_sm.vertical.condition.ALT_CPT),
+      FIELD(ap_sm.vertical.condition.ALT_CST),
+      FIELD(ap_sm.vertical.condition.ALT_CST_CPT),
+      FIELD(ap_sm.vertical.condition.CLB),
+      FIELD(ap_sm.vertical.condition.DES),
+      FIELD(ap_sm.vertical.condition.GS_CPT),
+      FIELD(ap_sm.vertical.condition.GS_TRACK),
+      FIELD(ap_sm.vertical.condition.LAND),
+      FIELD(ap_sm.vertical.condition.FLARE),
+      FIELD(ap_sm.vertical.condition.ROLL_OUT),
+      FIELD(ap_sm.vertical.condition.SRS),
+      FIELD(ap_sm.vertical.condition.SRS_GA),
+      FIELD(ap_sm.vertical.condition.THR_RED),
+      FIELD(ap_sm.vertical.condition.H_fcu_active),
+      FIELD(ap_sm.vertical.output.mode),
+      FIELD(ap_sm.vertical.output.mode_autothrust),
+      FIELD(ap_sm.vertical.output.mode_reversion),
+      FIELD(ap_sm.vertical.output.law),
+      FIELD(ap_sm.vertical.output.H_c_ft),
+      FIELD(ap_sm.vertical.output.H_dot_c_fpm),
+      FIELD(ap_sm.vertical.output.FPA_c_deg),
+      FIELD(ap_sm.vertical.output.V_c_kn),
+      FIELD(ap_sm.vertical.output.ALT_soft_mode_active),
+      FIELD(ap_sm.vertical.output.ALT_cruise_mode_active),
+      FIELD(ap_sm.vertical.output.EXPED_mode_active),
+      FIELD(ap_sm.vertical.output.speed_protection_mode),
+      FIELD(ap_sm.vertical.output.FD_disconnect),
+      FIELD(ap_sm.vertical.output.FD_connect),
+      FIELD(ap_sm.vertical_previous.armed.ALT),
+      FIELD(ap_sm.vertical_previous.armed.ALT_CST),
+      FIELD(ap_sm.vertical_previous.armed.CLB),
+      FIELD(ap_sm.vertical_previous.armed.DES),
+      FIELD(ap_sm.vertical_previous.armed.GS),
+      FIELD(ap_sm.vertical_previous.condition.ALT),
+      FIELD(ap_sm.vertical_previous.condition.ALT_CPT),
+      FIELD(ap_sm.vertical_previous.condition.ALT_CST),
+      FIELD(ap_sm.vertical_previous.condition.ALT_CST_CPT),
+      FIELD(ap_sm.vertical_previous.condition.CLB),
+      FIELD(ap_sm.vertical_previous.condition.DES),
+      FIELD(ap_sm.vertical_previous.condition.GS_CPT),
+      FIELD(ap_sm.vertical_previous.condition.GS_TRACK),
+      FIELD(ap_sm.vertical_previous.condition.LAND),
+      FIELD(ap_sm.vertical_previous.condition.FLARE),
+      FIELD(ap_sm.vertical_previous.condition.ROLL_OUT),
+      FIELD(ap_sm.vertical_previous.condition.SRS),
+      FIELD(ap_sm.vertical_previous.condition.SRS_GA),
+      FIELD(ap_sm.vertical_previous.condition.THR_RED),
+      FIELD(ap_sm.vertical_previous.condition.H_fcu_active),
+      FIELD(ap_sm.vertical_previous.output.mode),
+      FIELD(ap_sm.vertical_previous.output.mode_autothrust),
+      FIELD(ap_sm.vertical_previous.output.mode_reversion),
+      FIELD(ap_sm.vertical_previous.output.law),
+      FIELD(ap_sm.vertical_previous.output.H_c_ft),
+      FIELD(ap_sm.vertical_previous.output.H_dot_c_fpm),
+      FIELD(ap_sm.vertical_previous.output.FPA_c_deg),
+      FIELD(ap_sm.vertical_previous.output.V_c_kn),
+      FIELD(ap_sm.vertical_previous.output.ALT_soft_mode_active),
+      FIELD(ap_sm.vertical_previous.output.ALT_cruise_mode_active),
+      FIELD(ap_sm.vertical_previous.output.EXPED_mode_active),
+      FIELD(ap_sm.vertical_previous.output.speed_protection_mode),
+      FIELD(ap_sm.vertical_previous.output.FD_disconnect),
+      FIELD(ap_sm.vertical_previous.output.FD_connect),
+      FIELD(ap_sm.output.enabled_AP1),
+      FIELD(ap_sm.output.enabled_AP2),
+      FIELD(ap_sm.output.lateral_law),
+      FIELD(ap_sm.output.lateral_mode),
+      FIELD(ap_sm.output.lateral_mode_armed),
+      FIELD(ap_sm.output.vertical_law),
+      FIELD(ap_sm.output.vertical_mode),
+      FIELD(ap_sm.output.vertical_mode_armed),
+      FIELD(ap_sm.output.mode_reversion_lateral),
+      FIELD(ap_sm.output.mode_reversion_vertical),
+      FIELD(ap_sm.output.mode_reversion_TRK_FPA),
+      FIELD(ap_sm.output.mode_reversion_triple_click),
+      FIELD(ap_sm.output.mode_reversion_fma),
+      FIELD(ap_sm.output.speed_protection_mode),
+      FIELD(ap_sm.output.autothrust_mode),
+      FIELD(ap_sm.output.Psi_c_deg),
+      FIELD(ap_sm.output.H_c_ft),
+      FIELD(ap_sm.output.H_dot_c_fpm),
+      FIELD(ap_sm.output.FPA_c_deg),
+      FIELD(ap_sm.output.V_c_kn),
+      FIELD(ap_sm.output.ALT_soft_mode_active),
+      FIELD(ap_sm.output.ALT_cruise_mode_active),
+      FIELD(ap_sm.output.EXPED_mode_active),
+      FIELD(ap_sm.output.FD_disconnect),
+      FIELD(ap_sm.output.FD_connect),
+      FIELD(ap_law.ap_on),
+      FIELD(ap_law.Phi_loc_c),
+      FIELD(ap_law.flight_director.Theta_c_deg),
+      FIELD(ap_law.flight_director.Phi_c_deg),
+      FIELD(ap_law.flight_director.Beta_c_deg),
+      FIELD(ap_law.autopilot.Theta_c_deg),
+      FIELD(ap_law.autopilot.Phi_c_deg),
+      FIELD(ap_law.autopilot.Beta_c_deg),
+      FIELD(athr.time.dt),
+      FIELD(athr.time.simulation_time),
+      FIELD(athr.data.nz_g),
+      FIELD(athr.data.Theta_deg),
+      FIELD(athr.data.Phi_deg),
+      FIELD(athr.data.V_ias_kn),
+      FIELD(athr.data.V_tas_kn),
+      FIELD(athr.data.V_mach),
+      FIELD(athr.data.V_gnd_kn),
+      FIELD(athr.data.alpha_deg),
+      FIELD(athr.data.H_ft),
+      FIELD(athr.data.H_ind_ft),
+      FIELD(athr.data.H_radio_ft),
+      FIELD(athr.data.H_dot_fpm),
+      FIELD(athr.data.ax_m_s2),
+      FIELD(athr.data.ay_m_s2),
+      FIELD(athr.data.az_m_s2),
+      FIELD(athr.data.bx_m_s2),
+      FIELD(athr.data.by_m_s2),
+      FIELD(athr.data.bz_m_s2),
+      FIELD(athr.data.on_ground),
+      FIELD(athr.data.flap_handle_index),
+      FIELD(athr.data.is_engine_operative_1),
+      FIELD(athr.data.is_engine_operative_2),
+      FIELD(athr.data.commanded_engine_N1_1_percent),
+      FIELD(athr.data.commanded_engine_N1_2_percent),
+      FIELD(athr.data.engine_N1_1_percent),
+      FIELD(athr.data.engine_N1_2_percent),
+      FIELD(athr.data.TAT_degC),
+      FIELD(athr.data.OAT_degC),
+      FIELD(athr.data.ISA_degC),
+      FIELD(athr.data_computed.TLA_in_active_range),
+      FIELD(athr.data_computed.is_FLX_active),
+      FIELD(athr.data_computed.ATHR_push),
+      FIELD(athr.data_computed.ATHR_disabled),
+      FIELD(athr.data_computed.time_since_touchdown),
+      FIELD(athr.input.ATHR_push),
+      FIELD(athr.input.ATHR_disconnect),
+      FIELD(athr.input.TLA_1_deg),
+      FIELD(athr.input.TLA_2_deg),
+      FIELD(athr.input.V_c_kn),
+      FIELD(athr.input.V_LS_kn),
+      FIELD(athr.input.V_MAX_kn),
+      FIELD(athr.input.thrust_limit_REV_percent),
+      FIELD(athr.input.thrust_limit_IDLE_percent),
+      FIELD(athr.input.thrust_limit_CLB_percent),
+      FIELD(athr.input.thrust_limit_MCT_percent),
+      FIELD(athr.input.thrust_limit_FLEX_percent),
+      FIELD(athr.input.thrust_limit_TOGA_percent),
+      FIELD(athr.input.flex_temperature_degC),
+      FIELD(athr.input.mode_requested),
+      FIELD(athr.input.is_mach_mode_active),
+      FIELD(athr.input.alpha_floor_condition),
+      FIELD(athr.input.is_approach_mode_active),
+      FIELD(athr.input.is_SRS_TO_mode_active),
+      FIELD(athr.input.is_SRS_GA_mode_active),
+      FIELD(athr.input.is_LAND_mode_active),
+      FIELD(athr.input.thrust_reduction_altitude),
+      FIELD(athr.input.thrust_reduction_altitude_go_around),
+      FIELD(athr.input.flight_phase),
+      FIELD(athr.input.is_alt_soft_mode_active),
+      FIELD(athr.input.is_anti_ice_wing_active),
+      FIELD(athr.input.is_anti_ice_engine_1_active),
+      FIELD(athr.input.is_anti_ice_engine_2_active),
+      FIELD(athr.input.is_air_conditioning_1_active),
+      FIELD(athr.input.is_air_conditioning_2_active),
+      FIELD(athr.input.FD_active),
+      FIELD(athr.input.ATHR_reset_disable),
+      FIELD(athr.output.sim_throttle_lever_1_pos),
+      FIELD(athr.output.sim_throttle_lever_2_pos),
+      FIELD(athr.output.sim_thrust_mode_1),
+      FIELD(athr.output.sim_thrust_mode_2),
+      FIELD(athr.output.N1_TLA_1_percent),
+      FIELD(athr.output.N1_TLA_2_percent),
+      FIELD(athr.output.is_in_reverse_1),
+      FIELD(athr.output.is_in_reverse_2),
+      FIELD(athr.output.thrust_limit_type),
+      FIELD(athr.output.thrust_limit_percent),
+      FIELD(athr.output.N1_c_1_percent),
+      FIELD(athr.output.N1_c_2_percent),
+      FIELD(athr.output.status),
+      FIELD(athr.output.mode),
+      FIELD(athr.output.mode_message),
+      FIELD(athr.output.thrust_lever_warning_flex),
+      FIELD(athr.output.thrust_lever_warning_toga),
+      FIELD(fbw.sim.time.dt),
+      FIELD(fbw.sim.time.simulation_time),
+      FIELD(fbw.sim.time.monotonic_time),
+      FIELD(fbw.sim.data.nz_g),
+      FIELD(fbw.sim.data.Theta_deg),
+      FIELD(fbw.sim.data.Phi_deg),
+      FIELD(fbw.sim.data.q_deg_s),
+      FIELD(fbw.sim.data.r_deg_s),
+      FIELD(fbw.sim.data.p_deg_s),
+      FIELD(fbw.sim.data.qk_deg_s),
+      FIELD(fbw.sim.data.rk_deg_s),
+      FIELD(fbw.sim.data.pk_deg_s),
+      FIELD(fbw.sim.data.qk_dot_deg_s2),
+      FIELD(fbw.sim.data.rk_dot_deg_s2),
+      FIELD(fbw.sim.data.pk_dot_deg_s2),
+      FIELD(fbw.sim.data.psi_magnetic_deg),
+      FIELD(fbw.sim.data.psi_true_deg),
+      FIELD(fbw.sim.data.eta_deg),
+      FIELD(fbw.sim.data.eta_trim_deg),
+      FIELD(fbw.sim.data.xi_deg),
+      FIELD(fbw.sim.data.zeta_deg),
+      FIELD(fbw.sim.data.zeta_trim_deg),
+      FIELD(fbw.sim.data.alpha_deg),
+      FIELD(fbw.sim.data.beta_deg),
+      FIELD(fbw.sim.data.beta_dot_deg_s),
+      FIELD(fbw.sim.data.V_ias_kn),
+      FIELD(fbw.sim.data.V_tas_kn),
+      FIELD(fbw.sim.data.V_mach),
+      FIELD(fbw.sim.data.H_ft),
+      FIELD(fbw.sim.data.H_ind_ft),
+      FIELD(fbw.sim.data.H_radio_ft),
+      FIELD(fbw.sim.data.CG_percent_MAC),
+      FIELD(fbw.sim.data.total_weight_kg),
+      FIELD(fbw.sim.data.gear_strut_compression_0),
+      FIELD(fbw.sim.data.gear_strut_compression_1),
+      FIELD(fbw.sim.data.gear_strut_compression_2),
+      FIELD(fbw.sim.data.flaps_handle_index),
+      FIELD(fbw.sim.data.spoilers_left_pos),
+      FIELD(fbw.sim.data.spoilers_right_pos),
+      FIELD(fbw.sim.data.autopilot_master_on),
+      FIELD(fbw.sim.data.slew_on),
+      FIELD(fbw.sim.data.pause_on),
+      FIELD(fbw.sim.data.tracking_mode_on_override),
+      FIELD(fbw.sim.data.autopilot_custom_on),
+      FIELD(fbw.sim.data.autopilot_custom_Theta_c_deg),
+      FIELD(fbw.sim.data.autopilot_custom_Phi_c_deg),
+      FIELD(fbw.sim.data.autopilot_custom_Beta_c_deg),
+      FIELD(fbw.sim.data.simulation_rate),
+      FIELD(fbw.sim.data.ice_structure_percent),
+      FIELD(fbw.sim.data.linear_cl_alpha_per_deg),
+      FIELD(fbw.sim.data.alpha_stall_deg),
+      FIELD(fbw.sim.data.alpha_zero_lift_deg),
+      FIELD(fbw.sim.data.ambient_density_kg_per_m3),
+      FIELD(fbw.sim.data.ambient_pressure_mbar),
+      FIELD(fbw.sim.data.ambient_temperature_celsius),
+      FIELD(fbw.sim.data.ambient_wind_x_kn),
+      FIELD(fbw.sim.data.ambient_wind_y_kn),
+      FIELD(fbw.sim.data.ambient_wind_z_kn),
+      FIELD(fbw.sim.data.ambient_wind_velocity_kn),
+      FIELD(fbw.sim.data.ambient_wind_direction_deg),
+      FIELD(fbw.sim.data.total_air_temperature_celsius),
+      FIELD(fbw.sim.data.latitude_deg),
+      FIELD(fbw.sim.data.longitude_deg),
+      FIELD(fbw.sim.data.engine_1_thrust_lbf),
+      FIELD(fbw.sim.data.engine_2_thrust_lbf),
+      FIELD(fbw.sim.data.thrust_lever_1_pos),
+      FIELD(fbw.sim.data.thrust_lever_2_pos),
+      FIELD(fbw.sim.data.tailstrike_protection_on),
+      FIELD(fbw.sim.data.VLS_kn),
+      FIELD(fbw.sim.data_computed.on_ground),
+      FIELD(fbw.sim.data_computed.tracking_mode_on),
+      FIELD(fbw.sim.data_computed.high_aoa_prot_active),
+      FIELD(fbw.sim.data_computed.alpha_floor_command),
+      FIELD(fbw.sim.data_computed.protection_ap_disc),
+      FIELD(fbw.sim.data_computed.high_speed_prot_active),
+      FIELD(fbw.sim.data_computed.high_speed_prot_low_kn),
+      FIELD(fbw.sim.data_computed.high_speed_prot_high_kn),
+      FIELD(fbw.sim.data_speeds_aoa.v_alpha_max_kn),
+      FIELD(fbw.sim.data_speeds_aoa.alpha_max_deg),
+      FIELD(fbw.sim.data_speeds_aoa.v_alpha_prot_kn),
+      FIELD(fbw.sim.data_speeds_aoa.alpha_prot_deg),
+      FIELD(fbw.sim.data_speeds_aoa.alpha_floor_deg),
+      FIELD(fbw.sim.data_speeds_aoa.alpha_filtered_deg),
+      FIELD(fbw.sim.input.delta_eta_pos),
+      FIELD(fbw.sim.input.delta_xi_pos),
+      FIELD(fbw.sim.input.delta_zeta_pos),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_limit_lo),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_limit_up),
+      FIELD(fbw.pitch.data_computed.delta_eta_deg),
+      FIELD(fbw.pitch.data_computed.in_flight),
+      FIELD(fbw.pitch.data_computed.in_rotation),
+      FIELD(fbw.pitch.data_computed.in_flare),
+      FIELD(fbw.pitch.data_computed.in_flight_gain),
+      FIELD(fbw.pitch.data_computed.in_rotation_gain),
+      FIELD(fbw.pitch.data_computed.nz_limit_up_g),
+      FIELD(fbw.pitch.data_computed.nz_limit_lo_g),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_should_freeze),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_reset),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_reset_deg),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_should_write),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s),
+      FIELD(fbw.pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s),
+      FIELD(fbw.pitch.data_computed.flare_Theta_deg),
+      FIELD(fbw.pitch.data_computed.flare_Theta_c_deg),
+      FIELD(fbw.pitch.data_computed.flare_Theta_c_rate_deg_s),
+      FIELD(fbw.pitch.law_rotation.qk_c_deg_s),
+      FIELD(fbw.pitch.law_rotation.eta_deg),
+      FIELD(fbw.pitch.law_normal.nz_c_g),
+      FIELD(fbw.pitch.law_normal.Cstar_g),
+      FIELD(fbw.pitch.law_normal.protection_alpha_c_deg),
+      FIELD(fbw.pitch.law_normal.protection_V_c_kn),
+      FIELD(fbw.pitch.law_normal.eta_dot_deg_s),
+      FIELD(fbw.pitch.vote.eta_dot_deg_s),
+      FIELD(fbw.pitch.integrated.eta_deg),
+      FIELD(fbw.pitch.output.eta_deg),
+      FIELD(fbw.pitch.output.eta_trim_deg),
+      FIELD(fbw.roll.data_computed.delta_xi_deg),
+      FIELD(fbw.roll.data_computed.delta_zeta_deg),
+      FIELD(fbw.roll.data_computed.in_flight),
+      FIELD(fbw.roll.data_computed.in_flight_gain),
+      FIELD(fbw.roll.data_computed.zeta_trim_deg_should_write),
+      FIELD(fbw.roll.data_computed.beta_target_deg),
+      FIELD(fbw.roll.law_normal.pk_c_deg_s),
+      FIELD(fbw.roll.law_normal.Phi_c_deg),
+      FIELD(fbw.roll.law_normal.xi_deg),
+      FIELD(fbw.roll.law_normal.zeta_deg),
+      FIELD(fbw.roll.law_normal.zeta_tc_yd_deg),
+      FIELD(fbw.roll.output.xi_deg),
+      FIELD(fbw.roll.output.zeta_deg),
+      FIELD(fbw.roll.output.zeta_trim_deg),
+      FIELD(fbw.output.eta_pos),
+      FIELD(fbw.output.eta_trim_deg),
+      FIELD(fbw.output.eta_trim_deg_should_write),
+      FIELD(fbw.output.xi_pos),
+      FIELD(fbw.output.zeta_pos),
+      FIELD(fbw.output.zeta_trim_pos),
+      FIELD(fbw.output.zeta_trim_pos_should_write),
+      FIELD(engine.simOnGround),
+      FIELD(engine.generalEngineElapsedTime_1),
+      FIELD(engine.generalEngineElapsedTime_2),
+      FIELD(engine.standardAtmTemperature),
+      FIELD(engine.turbineEngineCorrectedFuelFlow_1),
+      FIELD(engine.turbineEngineCorrectedFuelFlow_2),
+      FIELD(engine.fuelTankCapacityAuxLeft),
+      FIELD(engine.fuelTankCapacityAuxRight),
+      FIELD(engine.fuelTankCapacityMainLeft),
+      FIELD(engine.fuelTankCapacityMainRight),
+      FIELD(engine.fuelTankCapacityCenter),
+      FIELD(engine.fuelTankQuantityAuxLeft),
+      FIELD(engine.fuelTankQuantityAuxRight),
+      FIELD(engine.fuelTankQuantityMainLeft),
+      FIELD(engine.fuelTankQuantityMainRight),
+      FIELD(engine.fuelTankQuantityCenter),
+      FIELD(engine.fuelTankQuantityTotal),
+      FIELD(engine.fuelWeightPerGallon),
+      FIELD(engine.engineEngine1N2),
+      FIELD(engine.engineEngine2N2),
+      FIELD(engine.engineEngine1N1),
+      FIELD(engine.engineEngine2N1),
+      FIELD(engine.engineEngineIdleN1),
+      FIELD(engine.engineEngineIdleN2),
+      FIELD(engine.engineEngineIdleFF),
+      FIELD(engine.engineEngineIdleEGT),
+      FIELD(engine.engineEngine1EGT),
+      FIELD(engine.engineEngine2EGT),
+      FIELD(engine.engineEngine1Oil),
+      FIELD(engine.engineEngine2Oil),
+      FIELD(engine.engineEngine1TotalOil),
+      FIELD(engine.engineEngine2TotalOil),
+      FIELD(engine.engineEngine1FF),
+      FIELD(engine.engineEngine2FF),
+      FIELD(engine.engineEngine1PreFF),
+      FIELD(engine.engineEngine2PreFF),
+      FIELD(engine.engineEngineImbalance),
+      FIELD(engine.engineFuelUsedLeft),
+      FIELD(engine.engineFuelUsedRight),
+      FIELD(engine.engineFuelLeftPre),
+      FIELD(engine.engineFuelRightPre),
+      FIELD(engine.engineFuelAuxLeftPre),
+      FIELD(engine.engineFuelAuxRightPre),
+      FIELD(engine.engineFuelCenterPre),
+      FIELD(engine.engineEngineCycleTime),
+      FIELD(engine.engineEngine1State),
+      FIELD(engine.engineEngine2State),
+      FIELD(engine.engineEngine1Timer),
+      FIELD(engine.engineEngine2Timer),
+  };
+  return fields;
+}
+
+#undef FIELD
@@ -0,0 +1,139 @@
+#include "FlightDataRecorderSparseBlock.h"
+
+#include <cstring>
+
+void FlightDataRecorderSparseBlock::initialize(const std::vector<FlightDataRecorderSchema::Field>& blockFields,
+                                               const std::vector<bool>& alwaysSet,
+                                               size_t blockSampleSize,
+                                               size_t blockCapacity) {
+  fields = &blockFields;
+  sampleSize = blockSampleSize;
+  capacity = blockCapacity > 0 ? blockCapacity : 1;
+  sampleCount = 0;
+  previous.assign(sampleSize, 0);
+
+  // build always mask
+  alwaysMask.assign((fields->size() + 7) / 8, 0);
+  for (size_t i = 0; i < fields->size() && i < alwaysSet.size(); i++) {
+    if (alwaysSet[i]) {
+      alwaysMask[i / 8] |= 1 << (i % 8);
+    }
+  }
+
+  // the block starts with the always mask
+  data.reserve(sampleSize * capacity);
+  data = alwaysMask;
+}
+
+void FlightDataRecorderSparseBlock::add(const void* sample) {
+  auto bytes = static_cast<const unsigned char*>(sample);
+
+  // reserve change mask
+  auto maskOffset = data.size();
+  data.resize(data.size() + alwaysMask.size(), 0);
+
+  for (size_t i = 0; i < fields->size(); i++) {
+    const auto& field = (*fields)[i];
+    auto value = bytes + field.offset;
+    auto isAlways = (alwaysMask[i / 8] >> (i % 8)) & 1;
+    if (!isAlways) {
+      // the first record of a block contains all fields
+      if (sampleCount > 0 && memcmp(value, previous.data() + field.offset, field.size) == 0) {
+        continue;
+      }
+      data[maskOffset + i / 8] |= 1 << (i % 8);
+    }
+    data.insert(data.end(), value, value + field.size);
+  }
+
+  memcpy(previous.data(), bytes, sampleSize);
+  sampleCount++;
+}
+
+std::vector<bool> FlightDataRecorderSparseBlock::getAlwaysChangingFields(const std::vector<FlightDataRecorderSchema::Field>& fields) {
+  static const std::vector<std::string> ALWAYS_CHANGING_PREFIXES = {
+      "ap_sm.time.", "ap_sm.data.", "athr.time.", "athr.data.", "fbw.sim.time.", "fbw.sim.data.",
+  };
+
+  std::vector<bool> result(fields.size(), false);
+  for (size_t i = 0; i < fields.size(); i++) {
+    if (fields[i].type != FlightDataRecorderSchema::FIELD_TYPE_REAL) {
+      continue;
+    }
+    for (const auto& prefix : ALWAYS_CHANGING_PREFIXES) {
+      if (fields[i].path.compare(0, prefix.size(), prefix) == 0) {
+        result[i] = true;
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+size_t FlightDataRecorderSparseBlock::getSampleCount() const {
+  return sampleCount;
+}
+
+bool FlightDataRecorderSparseBlock::isEmpty() const {
+  return sampleCount == 0;
+}
+
+bool FlightDataRecorderSparseBlock::isFull() const {
+  return sampleCount >= capacity;
+}
+
+void FlightDataRecorderSparseBlock::finish(std::vector<unsigned char>& encoded) {
+  encoded.swap(data);
+
+  // start new block
+  data.clear();
+  data.reserve(sampleSize * capacity);
+  data = alwaysMask;
+  sampleCount = 0;
+}
+
+bool FlightDataRecorderSparseBlock::decode(const unsigned char* encoded,
+                                           size_t size,
+                                           const std::vector<FlightDataRecorderSchema::Field>& fields,
+                                           size_t sampleSize,
+                                           size_t sampleCount,
+                                           unsigned char* samples) {
+  auto maskSize = (fields.size() + 7) / 8;
+  if (size < maskSize) {
+    return false;
+  }
+  auto alwaysMask = encoded;
+  size_t position = maskSize;
+
+  for (size_t row = 0; row < sampleCount; row++) {
+    // start from the previous sample, fields not in the schema stay zero
+    auto sample = samples + row * sampleSize;
+    if (row == 0) {
+      memset(sample, 0, sampleSize);
+    } else {
+      memcpy(sample, sample - sampleSize, sampleSize);
+    }
+
+    // read change mask
+    if (position + maskSize > size) {
+      return false;
+    }
+    auto changeMask = encoded + position;
+    position += maskSize;
+
+    // overwrite written fields
+    for (size_t i = 0; i < fields.size(); i++) {
+      if ((((alwaysMask[i / 8] | changeMask[i / 8]) >> (i % 8)) & 1) == 0) {
+        continue;
+      }
+      const auto& field = fields[i];
+      if (position + field.size > size || field.offset + field.size > sampleSize) {
+        return false;
+      }
+      memcpy(sample + field.offset, encoded + position, field.size);
+      position += field.size;
+    }
+  }
+
+  return position == size;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// Sparse encoding of a block of samples. Fields of the "always" set are written with every record, all other fields
+// only when they differ from the previous sample:
+//
+//   block  := always-mask record*
+//   record := change-mask value*
+//
+// Both masks have one bit per schema field (bit i = byte i / 8, bit i % 8). A record contains the values of all
+// fields of the always set and of all fields whose bit is set in its change mask, in schema order. The first record
+// of a block contains every field, which keeps blocks independent of each other.
+//
+// Mode flags, FMA states and constraints change a few times per flight, so most records consist of the mask and the
+// continuously changing values only. This reduces the amount of data fed into deflate per sample.
+class FlightDataRecorderSparseBlock {
+ public:
+  void initialize(const std::vector<FlightDataRecorderSchema::Field>& fields,
+                  const std::vector<bool>& alwaysSet,
+                  size_t sampleSize,
+                  size_t capacity);
+
+  void add(const void* sample);
+
+  // default always set: continuous values of time and sensor data
+  static std::vector<bool> getAlwaysChangingFields(const std::vector<FlightDataRecorderSchema::Field>& fields);
+
+  size_t getSampleCount() const;
+  bool isEmpty() const;
+  bool isFull() const;
+
+  // moves the encoded block into the given buffer and starts a new block
+  void finish(std::vector<unsigned char>& encoded);
+
+  // reverses the encoding of a block with the given number of samples, returns false if the data is inconsistent
+  static bool decode(const unsigned char* encoded,
+                     size_t size,
+                     const std::vector<FlightDataRecorderSchema::Field>& fields,
+                     size_t sampleSize,
+                     size_t sampleCount,
+                     unsigned char* samples);
+
+ private:
+  const std::vector<FlightDataRecorderSchema::Field>* fields = nullptr;
+  std::vector<unsigned char> alwaysMask;
+  size_t sampleSize = 0;
+  size_t capacity = 0;
+  size_t sampleCount = 0;
+
+  std::vector<unsigned char> previous;
+  std::vector<unsigned char> data;
+};
@@ -0,0 +1,106 @@
+#include "FlightDataRecorderStatistics.h"
+
+#include <algorithm>
+#include <iomanip>
+
+using namespace std;
+
+void FlightDataRecorderStatistics::Histogram::add(chrono::nanoseconds duration) {
+  auto nanoseconds = static_cast<uint64_t>(max(duration.count(), static_cast<chrono::nanoseconds::rep>(0)));
+
+  // bucket is the number of significant bits
+  uint32_t bucket = 0;
+  for (auto value = nanoseconds; value != 0 && bucket < FlightDataRecorderFormat::HISTOGRAM_BUCKETS - 1; value >>= 1) {
+    bucket++;
+  }
+
+  count.fetch_add(1, memory_order_relaxed);
+  totalNanoseconds.fetch_add(nanoseconds, memory_order_relaxed);
+  buckets[bucket].fetch_add(1, memory_order_relaxed);
+  auto maximum = maximumNanoseconds.load(memory_order_relaxed);
+  while (nanoseconds > maximum && !maximumNanoseconds.compare_exchange_weak(maximum, nanoseconds, memory_order_relaxed)) {
+  }
+}
+
+void FlightDataRecorderStatistics::Histogram::reset() {
+  count = 0;
+  totalNanoseconds = 0;
+  maximumNanoseconds = 0;
+  for (auto& bucket : buckets) {
+    bucket = 0;
+  }
+}
+
+FlightDataRecorderFormat::Histogram FlightDataRecorderStatistics::Histogram::get() const {
+  FlightDataRecorderFormat::Histogram result = {};
+  result.count = count.load(memory_order_relaxed);
+  result.totalNanoseconds = totalNanoseconds.load(memory_order_relaxed);
+  result.maximumNanoseconds = maximumNanoseconds.load(memory_order_relaxed);
+  for (uint32_t i = 0; i < FlightDataRecorderFormat::HISTOGRAM_BUCKETS; i++) {
+    result.buckets[i] = buckets[i].load(memory_order_relaxed);
+  }
+  return result;
+}
+
+void FlightDataRecorderStatistics::addSample() {
+  sampleCount.fetch_add(1, memory_order_relaxed);
+}
+
+void FlightDataRecorderStatistics::addBytes(uint64_t in, uint64_t out) {
+  bytesIn.fetch_add(in, memory_order_relaxed);
+  bytesOut.fetch_add(out, memory_order_relaxed);
+}
+
+void FlightDataRecorderStatistics::reset() {
+  updateTime.reset();
+  rotationTime.reset();
+  sampleCount = 0;
+  bytesIn = 0;
+  bytesOut = 0;
+}
+
+FlightDataRecorderFormat::Statistics FlightDataRecorderStatistics::get() const {
+  FlightDataRecorderFormat::Statistics result = {};
+  result.sampleCount = sampleCount.load(memory_order_relaxed);
+  result.bytesIn = bytesIn.load(memory_order_relaxed);
+  result.bytesOut = bytesOut.load(memory_order_relaxed);
+  result.updateTime = updateTime.get();
+  result.rotationTime = rotationTime.get();
+  return result;
+}
+
+double FlightDataRecorderStatistics::getPercentileMicroseconds(const FlightDataRecorderFormat::Histogram& histogram, double fraction) {
+  if (histogram.count == 0) {
+    return 0;
+  }
+
+  // find bucket containing the requested rank
+  auto rank = fraction * histogram.count;
+  uint64_t cumulative = 0;
+  for (uint32_t i = 0; i < FlightDataRecorderFormat::HISTOGRAM_BUCKETS; i++) {
+    cumulative += histogram.buckets[i];
+    if (cumulative >= rank && histogram.buckets[i] > 0) {
+      // the maximum is a tighter bound for the highest bucket
+      return min(static_cast<double>(1ULL << i), static_cast<double>(histogram.maximumNanoseconds)) / 1000.0;
+    }
+  }
+  return histogram.maximumNanoseconds / 1000.0;
+}
+
+static void printHistogram(ostream& out, const string& prefix, const string& name, const FlightDataRecorderFormat::Histogram& histogram) {
+  auto average = histogram.count > 0 ? histogram.totalNanoseconds / 1000.0 / histogram.count : 0.0;
+  out << prefix << name << "count = " << histogram.count << ", avg = " << average
+      << " us, p50 < " << FlightDataRecorderStatistics::getPercentileMicroseconds(histogram, 0.5)
+      << " us, p99 < " << FlightDataRecorderStatistics::getPercentileMicroseconds(histogram, 0.99)
+      << " us, max = " << histogram.maximumNanoseconds / 1000.0 << " us" << endl;
+}
+
+void FlightDataRecorderStatistics::print(ostream& out, const string& prefix, const FlightDataRecorderFormat::Statistics& statistics) {
+  auto ratio = statistics.bytesOut > 0 ? static_cast<double>(statistics.bytesIn) / statistics.bytesOut : 0.0;
+  out << prefix << "Samples                        = " << statistics.sampleCount << endl;
+  out << prefix << "BytesIn                        = " << statistics.bytesIn << endl;
+  out << prefix << "BytesOut                       = " << statistics.bytesOut << endl;
+  out << prefix << "CompressionRatio               = " << fixed << setprecision(2) << ratio << defaultfloat << setprecision(6) << endl;
+  printHistogram(out, prefix, "UpdateTime                     : ", statistics.updateTime);
+  printHistogram(out, prefix, "RotationTime                   : ", statistics.rotationTime);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "FlightDataRecorderFormat.h"
+
+// Cost of the flight data recorder itself. Durations are collected in log2 bucketed histograms, so percentiles can be
+// estimated without storing single values. Counters are atomic because update and writer stage may run on different
+// threads.
+class FlightDataRecorderStatistics {
+ public:
+  class Histogram {
+   public:
+    void add(std::chrono::nanoseconds duration);
+    void reset();
+    FlightDataRecorderFormat::Histogram get() const;
+
+   private:
+    std::atomic<uint64_t> count = 0;
+    std::atomic<uint64_t> totalNanoseconds = 0;
+    std::atomic<uint64_t> maximumNanoseconds = 0;
+    std::atomic<uint64_t> buckets[FlightDataRecorderFormat::HISTOGRAM_BUCKETS] = {};
+  };
+
+  Histogram updateTime;
+  Histogram rotationTime;
+
+  void addSample();
+  void addBytes(uint64_t bytesIn, uint64_t bytesOut);
+  void reset();
+
+  FlightDataRecorderFormat::Statistics get() const;
+
+  // estimated duration below which the given fraction of the values lies (upper bound of the bucket)
+  static double getPercentileMicroseconds(const FlightDataRecorderFormat::Histogram& histogram, double fraction);
+
+  // prints a summary with one line per value, each line starts with the given prefix
+  static void print(std::ostream& out, const std::string& prefix, const FlightDataRecorderFormat::Statistics& statistics);
+
+ private:
+  std::atomic<uint64_t> sampleCount = 0;
+  std::atomic<uint64_t> bytesIn = 0;
+  std::atomic<uint64_t> bytesOut = 0;
+};
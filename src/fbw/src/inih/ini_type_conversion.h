@@ -49,6 +49,20 @@ class INITypeConversion {
     return value;
   }
 
+  static std::string getString(mINI::INIStructure structure,
+                               const std::string& section,
+                               const std::string& key,
+                               const std::string& defaultValue = "") {
+    if (!structure.has(section) || !structure.get(section).has(key)) {
+      return defaultValue;
+    }
+
+    // transform to upper case string to allow case insensitive enumerations
+    std::string value = structure.get(section).get(key);
+    transform(value.begin(), value.end(), value.begin(), ::toupper);
+    return value;
+  }
+
  private:
   static bool getBooleanFromString(const std::string& value) {
     // transform to lower case string
@@ -0,0 +1,335 @@
+#include "HostFlightModel.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+static constexpr double PI = 3.14159265358979323846;
+static constexpr double DEG_TO_RAD = PI / 180.0;
+static constexpr double FEET_TO_METERS = 0.3048;
+static constexpr double KNOTS_TO_METERS_PER_SECOND = 0.514444;
+static constexpr double NEWTONS_TO_POUNDS = 1.0 / 4.44822;
+static constexpr double GRAVITY = 9.80665;
+static constexpr double EARTH_RADIUS = 6371000;
+
+// atmosphere
+static constexpr double SEA_LEVEL_TEMPERATURE = 288.15;
+static constexpr double SEA_LEVEL_PRESSURE = 101325;
+static constexpr double SEA_LEVEL_DENSITY = 1.225;
+static constexpr double TEMPERATURE_LAPSE_RATE = 0.0065;
+static constexpr double TROPOPAUSE_ALTITUDE = 11000;
+static constexpr double GAS_CONSTANT = 287.053;
+
+// geometry and inertia
+static constexpr double WING_AREA = 77.0;
+static constexpr double MEAN_AERODYNAMIC_CHORD = 3.5;
+static constexpr double PITCH_INERTIA_PER_MASS = 60.0;
+
+// aerodynamics, angles in radians and flaps in degrees
+static constexpr double LIFT_CURVE_SLOPE = 5.0;
+static constexpr double ZERO_LIFT_ANGLE_OF_ATTACK = -2.0 * DEG_TO_RAD;
+static constexpr double STALL_ANGLE_OF_ATTACK = 15.0 * DEG_TO_RAD;
+static constexpr double LIFT_PER_FLAPS_ANGLE = 0.025;
+static constexpr double LIFT_PER_SPOILERS = -0.3;
+static constexpr double ZERO_LIFT_DRAG = 0.022;
+static constexpr double INDUCED_DRAG_FACTOR = 0.045;
+static constexpr double DRAG_PER_FLAPS_ANGLE = 0.0015;
+static constexpr double DRAG_PER_SPOILERS = 0.04;
+static constexpr double DRAG_OF_GEAR = 0.02;
+static constexpr double PITCH_MOMENT_NEUTRAL_ANGLE_OF_ATTACK = 3.0 * DEG_TO_RAD;
+static constexpr double PITCH_MOMENT_ANGLE_OF_ATTACK = -1.2;
+static constexpr double PITCH_MOMENT_PITCH_RATE = -25.0;
+static constexpr double PITCH_MOMENT_ELEVATOR = 0.8;
+static constexpr double PITCH_MOMENT_TRIM_PER_DEGREE = 0.04;
+static constexpr double PITCH_MOMENT_PER_FLAPS_ANGLE = -0.002;
+static constexpr double ROLL_DAMPING = -1.5;
+static constexpr double ROLL_CONTROL = 0.5;
+static constexpr double ROLL_REFERENCE_DYNAMIC_PRESSURE = 10000;
+
+// flaps
+static constexpr double FLAPS_ANGLE_PER_INDEX = 10.0;
+static constexpr double FLAPS_RATE = 2.0;
+
+// engines
+static constexpr double ENGINE_IDLE_N1 = 20.0;
+static constexpr double ENGINE_MAX_N1 = 100.0;
+static constexpr double ENGINE_TIME_CONSTANT = 2.0;
+static constexpr double ENGINE_MAX_THRUST = 77000;
+static constexpr double ENGINE_ZERO_THRUST_N1 = 19.0;
+
+// sign conventions of the simulator relative to the aircraft axes of the model
+static constexpr double AILERON_SIGN = 1.0;
+static constexpr double TRIM_SIGN = 1.0;
+
+// longest step of the integration, the sample time of the module is split into steps of this size
+static constexpr double MAX_INTEGRATION_STEP = 0.01;
+
+struct Atmosphere {
+  double temperature;
+  double pressure;
+  double density;
+  double speedOfSound;
+};
+
+static Atmosphere getAtmosphere(double altitude) {
+  Atmosphere atmosphere;
+  auto h = max(0.0, altitude);
+  if (h <= TROPOPAUSE_ALTITUDE) {
+    atmosphere.temperature = SEA_LEVEL_TEMPERATURE - TEMPERATURE_LAPSE_RATE * h;
+    atmosphere.pressure =
+        SEA_LEVEL_PRESSURE * pow(atmosphere.temperature / SEA_LEVEL_TEMPERATURE, GRAVITY / (TEMPERATURE_LAPSE_RATE * GAS_CONSTANT));
+  } else {
+    atmosphere.temperature = SEA_LEVEL_TEMPERATURE - TEMPERATURE_LAPSE_RATE * TROPOPAUSE_ALTITUDE;
+    auto tropopausePressure =
+        SEA_LEVEL_PRESSURE * pow(atmosphere.temperature / SEA_LEVEL_TEMPERATURE, GRAVITY / (TEMPERATURE_LAPSE_RATE * GAS_CONSTANT));
+    atmosphere.pressure = tropopausePressure * exp(-GRAVITY * (h - TROPOPAUSE_ALTITUDE) / (GAS_CONSTANT * atmosphere.temperature));
+  }
+  atmosphere.density = atmosphere.pressure / (GAS_CONSTANT * atmosphere.temperature);
+  atmosphere.speedOfSound = sqrt(1.4 * GAS_CONSTANT * atmosphere.temperature);
+  return atmosphere;
+}
+
+static double getEngineThrust(double n1, double density) {
+  auto ratio = max(0.0, (n1 - ENGINE_ZERO_THRUST_N1) / (ENGINE_MAX_N1 - ENGINE_ZERO_THRUST_N1));
+  return ENGINE_MAX_THRUST * pow(density / SEA_LEVEL_DENSITY, 0.8) * ratio * ratio;
+}
+
+static double getCommandedN1(double throttleLeverPercent) {
+  return ENGINE_IDLE_N1 + (ENGINE_MAX_N1 - ENGINE_IDLE_N1) * clamp(throttleLeverPercent, 0.0, 100.0) / 100.0;
+}
+
+static double wrapDegrees(double angle) {
+  angle = fmod(angle, 360.0);
+  return angle < 0 ? angle + 360.0 : angle;
+}
+
+void HostFlightModel::initialize(HostSimulation& simulation, const InitialConditions& conditions) {
+  simulationTime = 0;
+  altitude = conditions.altitude_ft * FEET_TO_METERS;
+  latitude = conditions.latitude_deg;
+  longitude = conditions.longitude_deg;
+  heading = conditions.heading_deg * DEG_TO_RAD;
+  mass = conditions.weight_kg;
+  flapsAngle = conditions.flapsHandleIndex * FLAPS_ANGLE_PER_INDEX;
+  gearPosition = conditions.isGearDown ? 1 : 0;
+  flightPathAngle = 0;
+  pitchRate = 0;
+  bank = 0;
+  rollRate = 0;
+
+  // lift equals weight, the trim balances the pitching moment and the thrust the drag
+  auto atmosphere = getAtmosphere(altitude);
+  trueAirspeed = conditions.airspeed_kn * KNOTS_TO_METERS_PER_SECOND / sqrt(atmosphere.density / SEA_LEVEL_DENSITY);
+  auto dynamicPressure = 0.5 * atmosphere.density * trueAirspeed * trueAirspeed;
+  auto liftCoefficient = mass * GRAVITY / (dynamicPressure * WING_AREA);
+  angleOfAttack = (liftCoefficient - LIFT_PER_FLAPS_ANGLE * flapsAngle) / LIFT_CURVE_SLOPE + ZERO_LIFT_ANGLE_OF_ATTACK;
+  auto pitchMoment = PITCH_MOMENT_ANGLE_OF_ATTACK * (angleOfAttack - PITCH_MOMENT_NEUTRAL_ANGLE_OF_ATTACK) +
+                     PITCH_MOMENT_PER_FLAPS_ANGLE * flapsAngle;
+  auto trim = -pitchMoment / PITCH_MOMENT_TRIM_PER_DEGREE;
+  auto drag = dynamicPressure * WING_AREA *
+              (ZERO_LIFT_DRAG + INDUCED_DRAG_FACTOR * liftCoefficient * liftCoefficient + DRAG_PER_FLAPS_ANGLE * flapsAngle +
+               DRAG_OF_GEAR * gearPosition);
+  auto maxThrust = getEngineThrust(ENGINE_MAX_N1, atmosphere.density);
+  auto n1 = ENGINE_ZERO_THRUST_N1 + (ENGINE_MAX_N1 - ENGINE_ZERO_THRUST_N1) * sqrt(min(1.0, drag / (2 * maxThrust)));
+  for (size_t i = 0; i < 2; i++) {
+    engineN1[i] = n1;
+    engineElapsedTime[i] = 0;
+  }
+  auto throttleLever = 100.0 * (n1 - ENGINE_IDLE_N1) / (ENGINE_MAX_N1 - ENGINE_IDLE_N1);
+
+  // inputs of the model, written by the module from now on
+  simulation.setSimVar("ELEVATOR POSITION", 0);
+  simulation.setSimVar("AILERON POSITION", 0);
+  simulation.setSimVar("RUDDER POSITION", 0);
+  simulation.setSimVar("ELEVATOR TRIM POSITION", TRIM_SIGN * trim);
+  simulation.setSimVar("RUDDER TRIM PCT", 0);
+  simulation.setSimVar("GENERAL ENG THROTTLE LEVER POSITION:1", throttleLever);
+  simulation.setSimVar("GENERAL ENG THROTTLE LEVER POSITION:2", throttleLever);
+  simulation.setSimVar("FLAPS HANDLE INDEX", conditions.flapsHandleIndex);
+  simulation.setSimVar("SPOILERS HANDLE POSITION", 0);
+
+  // constant variables of the aircraft and the environment
+  simulation.setSimVar("CG PERCENT", 0.25);
+  simulation.setSimVar("LINEAR CL ALPHA", LIFT_CURVE_SLOPE * DEG_TO_RAD);
+  simulation.setSimVar("STALL ALPHA", STALL_ANGLE_OF_ATTACK / DEG_TO_RAD);
+  simulation.setSimVar("ZERO LIFT ALPHA", ZERO_LIFT_ANGLE_OF_ATTACK / DEG_TO_RAD);
+  simulation.setSimVar("SIMULATION RATE", 1);
+  simulation.setSimVar("CAMERA STATE", 2);
+  simulation.setSimVar("AUTOPILOT FLIGHT DIRECTOR ACTIVE:1", 1);
+  simulation.setSimVar("AUTOPILOT FLIGHT DIRECTOR ACTIVE:2", 1);
+  simulation.setSimVar("ENG COMBUSTION:1", 1);
+  simulation.setSimVar("ENG COMBUSTION:2", 1);
+  simulation.setSimVar("FUEL WEIGHT PER GALLON", 6.7);
+  simulation.setSimVar("FUEL TANK LEFT MAIN CAPACITY", 1150);
+  simulation.setSimVar("FUEL TANK RIGHT MAIN CAPACITY", 1150);
+  simulation.setSimVar("FUEL TANK CENTER CAPACITY", 1050);
+  simulation.setSimVar("FUEL TANK LEFT MAIN QUANTITY", 900);
+  simulation.setSimVar("FUEL TANK RIGHT MAIN QUANTITY", 900);
+  simulation.setSimVar("FUEL TOTAL QUANTITY", 1800);
+
+  // the selections of the flight control unit, held by the instruments in the simulator
+  simulation.setSimVar("AUTOPILOT AIRSPEED HOLD VAR", conditions.airspeed_kn);
+  simulation.setSimVar("AUTOPILOT ALTITUDE LOCK VAR:3", conditions.altitude_ft);
+  simulation.setNamedVariable("A32NX_AUTOPILOT_HEADING_SELECTED", conditions.heading_deg);
+  simulation.setNamedVariable("A32NX_AUTOPILOT_VS_SELECTED", 0);
+
+  // values of the flight management and the engine control that do not run on the host
+  simulation.setNamedVariable("A32NX_FMGC_FLIGHT_PHASE", 3);
+  simulation.setNamedVariable("A32NX_SPEEDS_VLS", 130);
+  simulation.setNamedVariable("A32NX_SPEEDS_VMAX", 340);
+  simulation.setNamedVariable("A32NX_ENGINE_IDLE_N1", ENGINE_IDLE_N1);
+
+  step(simulation, 0);
+  writeSimVars(simulation);
+}
+
+void HostFlightModel::update(HostSimulation& simulation, double sampleTime) {
+  auto steps = max(1.0, ceil(sampleTime / MAX_INTEGRATION_STEP));
+  for (size_t i = 0; i < steps; i++) {
+    step(simulation, sampleTime / steps);
+  }
+  simulationTime += sampleTime;
+  writeSimVars(simulation);
+}
+
+void HostFlightModel::step(HostSimulation& simulation, double dt) {
+  // inputs
+  auto elevator = simulation.getSimVar("ELEVATOR POSITION");
+  auto aileron = AILERON_SIGN * simulation.getSimVar("AILERON POSITION");
+  auto trim = TRIM_SIGN * simulation.getSimVar("ELEVATOR TRIM POSITION");
+  auto spoilers = clamp(simulation.getSimVar("SPOILERS HANDLE POSITION"), 0.0, 1.0);
+  auto flapsTarget = FLAPS_ANGLE_PER_INDEX * simulation.getSimVar("FLAPS HANDLE INDEX");
+
+  // flaps and engines
+  flapsAngle += clamp(flapsTarget - flapsAngle, -FLAPS_RATE * dt, FLAPS_RATE * dt);
+  auto atmosphere = getAtmosphere(altitude);
+  for (size_t i = 0; i < 2; i++) {
+    auto lever = simulation.getSimVar(i == 0 ? "GENERAL ENG THROTTLE LEVER POSITION:1" : "GENERAL ENG THROTTLE LEVER POSITION:2");
+    engineN1[i] += (getCommandedN1(lever) - engineN1[i]) * min(1.0, dt / ENGINE_TIME_CONSTANT);
+    engineElapsedTime[i] += dt;
+    thrust[i] = getEngineThrust(engineN1[i], atmosphere.density);
+  }
+  auto totalThrust = thrust[0] + thrust[1];
+
+  // forces
+  auto dynamicPressure = 0.5 * atmosphere.density * trueAirspeed * trueAirspeed;
+  auto liftCoefficient = LIFT_CURVE_SLOPE * (angleOfAttack - ZERO_LIFT_ANGLE_OF_ATTACK) + LIFT_PER_FLAPS_ANGLE * flapsAngle +
+                         LIFT_PER_SPOILERS * spoilers;
+  auto dragCoefficient = ZERO_LIFT_DRAG + INDUCED_DRAG_FACTOR * liftCoefficient * liftCoefficient + DRAG_PER_FLAPS_ANGLE * flapsAngle +
+                         DRAG_PER_SPOILERS * spoilers + DRAG_OF_GEAR * gearPosition;
+  auto lift = dynamicPressure * WING_AREA * liftCoefficient;
+  auto drag = dynamicPressure * WING_AREA * dragCoefficient;
+  auto normalForce = lift + totalThrust * sin(angleOfAttack);
+  auto weight = mass * GRAVITY;
+
+  // moments
+  auto pitchMoment = PITCH_MOMENT_ANGLE_OF_ATTACK * (angleOfAttack - PITCH_MOMENT_NEUTRAL_ANGLE_OF_ATTACK) +
+                     PITCH_MOMENT_PITCH_RATE * pitchRate * MEAN_AERODYNAMIC_CHORD / (2 * trueAirspeed) +
+                     PITCH_MOMENT_ELEVATOR * elevator + PITCH_MOMENT_TRIM_PER_DEGREE * trim + PITCH_MOMENT_PER_FLAPS_ANGLE * flapsAngle;
+  auto pitchInertia = PITCH_INERTIA_PER_MASS * mass;
+
+  // derivatives
+  longitudinalAcceleration = (totalThrust * cos(angleOfAttack) - drag) / mass - GRAVITY * sin(flightPathAngle);
+  normalAcceleration = (normalForce - weight * cos(flightPathAngle) * cos(bank)) / mass;
+  pitchAcceleration = dynamicPressure * WING_AREA * MEAN_AERODYNAMIC_CHORD * pitchMoment / pitchInertia;
+  rollAcceleration = ROLL_DAMPING * rollRate + ROLL_CONTROL * aileron * dynamicPressure / ROLL_REFERENCE_DYNAMIC_PRESSURE;
+  loadFactor = normalForce / weight;
+  auto flightPathAngleRate = (normalForce * cos(bank) - weight * cos(flightPathAngle)) / (mass * trueAirspeed);
+  auto headingRate = normalForce * sin(bank) / (mass * trueAirspeed * cos(flightPathAngle));
+
+  // integration
+  auto groundSpeed = trueAirspeed * cos(flightPathAngle);
+  latitude += groundSpeed * cos(heading) * dt / EARTH_RADIUS / DEG_TO_RAD;
+  longitude += groundSpeed * sin(heading) * dt / (EARTH_RADIUS * cos(latitude * DEG_TO_RAD)) / DEG_TO_RAD;
+  altitude += trueAirspeed * sin(flightPathAngle) * dt;
+  trueAirspeed = max(1.0, trueAirspeed + longitudinalAcceleration * dt);
+  angleOfAttack += (pitchRate - normalAcceleration / trueAirspeed) * dt;
+  flightPathAngle += flightPathAngleRate * dt;
+  heading += headingRate * dt;
+  pitchRate += pitchAcceleration * dt;
+  bank += rollRate * dt;
+  rollRate += rollAcceleration * dt;
+
+  // the model does not roll on the ground, it stops descending
+  if (altitude <= 0) {
+    altitude = 0;
+    flightPathAngle = max(0.0, flightPathAngle);
+  }
+}
+
+void HostFlightModel::writeSimVars(HostSimulation& simulation) const {
+  auto atmosphere = getAtmosphere(altitude);
+  auto pitch = flightPathAngle + angleOfAttack * cos(bank);
+  auto headingRate = loadFactor * GRAVITY * sin(bank) / (trueAirspeed * cos(flightPathAngle));
+  auto yawRate = headingRate * cos(pitch) * cos(bank);
+  auto headingDegrees = wrapDegrees(heading / DEG_TO_RAD);
+  auto indicatedAirspeed = trueAirspeed * sqrt(atmosphere.density / SEA_LEVEL_DENSITY) / KNOTS_TO_METERS_PER_SECOND;
+  auto isOnGround = altitude <= 0;
+
+  // attitude and rates, pitch is positive nose down and bank positive left wing down in the simulator
+  simulation.setSimVar("G FORCE", loadFactor);
+  simulation.setSimVar("PLANE PITCH DEGREES", -pitch / DEG_TO_RAD);
+  simulation.setSimVar("PLANE BANK DEGREES", -bank / DEG_TO_RAD);
+  simulation.setSimVar("STRUCT BODY ROTATION VELOCITY.x", -pitchRate);
+  simulation.setSimVar("STRUCT BODY ROTATION VELOCITY.y", yawRate);
+  simulation.setSimVar("STRUCT BODY ROTATION VELOCITY.z", -rollRate);
+  simulation.setSimVar("STRUCT BODY ROTATION ACCELERATION.x", -pitchAcceleration);
+  simulation.setSimVar("STRUCT BODY ROTATION ACCELERATION.y", 0);
+  simulation.setSimVar("STRUCT BODY ROTATION ACCELERATION.z", -rollAcceleration);
+  simulation.setSimVar("ACCELERATION BODY Z", longitudinalAcceleration);
+  simulation.setSimVar("ACCELERATION BODY X", 0);
+  simulation.setSimVar("ACCELERATION BODY Y", normalAcceleration);
+  simulation.setSimVar("PLANE HEADING DEGREES MAGNETIC", headingDegrees);
+  simulation.setSimVar("PLANE HEADING DEGREES TRUE", headingDegrees);
+  simulation.setSimVar("GPS GROUND MAGNETIC TRACK", headingDegrees);
+  simulation.setSimVar("INCIDENCE ALPHA", angleOfAttack / DEG_TO_RAD);
+  simulation.setSimVar("INCIDENCE BETA", 0);
+  simulation.setSimVar("BETA DOT", 0);
+
+  // speeds and altitudes
+  simulation.setSimVar("AIRSPEED INDICATED", indicatedAirspeed);
+  simulation.setSimVar("AIRSPEED TRUE", trueAirspeed / KNOTS_TO_METERS_PER_SECOND);
+  simulation.setSimVar("AIRSPEED MACH", trueAirspeed / atmosphere.speedOfSound);
+  simulation.setSimVar("GROUND VELOCITY", trueAirspeed * cos(flightPathAngle) / KNOTS_TO_METERS_PER_SECOND);
+  simulation.setSimVar("INDICATED ALTITUDE:3", altitude / FEET_TO_METERS);
+  simulation.setSimVar("INDICATED ALTITUDE", altitude / FEET_TO_METERS);
+  simulation.setSimVar("PLANE ALT ABOVE GROUND MINUS CG", altitude / FEET_TO_METERS);
+  simulation.setSimVar("PLANE ALTITUDE", altitude);
+  simulation.setSimVar("VELOCITY WORLD Y", trueAirspeed * sin(flightPathAngle) / FEET_TO_METERS * 60.0);
+  simulation.setSimVar("PLANE LATITUDE", latitude);
+  simulation.setSimVar("PLANE LONGITUDE", longitude);
+
+  // configuration, the gear animation is at half when extended and not compressed
+  simulation.setSimVar("TOTAL WEIGHT", mass);
+  auto gearAnimation = isOnGround ? 1.0 : 0.5 * gearPosition;
+  simulation.setSimVar("GEAR ANIMATION POSITION:0", gearAnimation);
+  simulation.setSimVar("GEAR ANIMATION POSITION:1", gearAnimation);
+  simulation.setSimVar("GEAR ANIMATION POSITION:2", gearAnimation);
+  simulation.setSimVar("TRAILING EDGE FLAPS LEFT ANGLE", flapsAngle);
+  auto spoilers = clamp(simulation.getSimVar("SPOILERS HANDLE POSITION"), 0.0, 1.0);
+  simulation.setSimVar("SPOILERS LEFT POSITION", spoilers);
+  simulation.setSimVar("SPOILERS RIGHT POSITION", spoilers);
+  simulation.setSimVar("SIM ON GROUND", isOnGround ? 1 : 0);
+  simulation.setSimVar("SIMULATION TIME", simulationTime);
+
+  // environment
+  auto temperature = atmosphere.temperature - 273.15;
+  simulation.setSimVar("AMBIENT DENSITY", atmosphere.density);
+  simulation.setSimVar("AMBIENT PRESSURE", atmosphere.pressure / 100.0);
+  simulation.setSimVar("AMBIENT TEMPERATURE", temperature);
+  simulation.setSimVar("STANDARD ATM TEMPERATURE", temperature);
+  simulation.setSimVar("TOTAL AIR TEMPERATURE", temperature + trueAirspeed * trueAirspeed / 2010.0);
+
+  // engines
+  for (size_t i = 0; i < 2; i++) {
+    auto index = to_string(i + 1);
+    auto lever = simulation.getSimVar("GENERAL ENG THROTTLE LEVER POSITION:" + index);
+    simulation.setSimVar("TURB ENG COMMANDED N1:" + index, getCommandedN1(lever));
+    simulation.setSimVar("TURB ENG N1:" + index, engineN1[i]);
+    simulation.setSimVar("TURB ENG CORRECTED N1:" + index, engineN1[i]);
+    simulation.setSimVar("TURB ENG JET THRUST:" + index, thrust[i] * NEWTONS_TO_POUNDS);
+    simulation.setSimVar("TURB ENG CORRECTED FF:" + index, 600.0 + 60.0 * (engineN1[i] - ENGINE_IDLE_N1));
+    simulation.setSimVar("GENERAL ENG ELAPSED TIME:" + index, engineElapsedTime[i]);
+  }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "HostSimulation.h"
+
+// Simple flight model of a twin jet in the class of the aircraft, it replaces the simulator in closed loop.
+//
+// The longitudinal motion is a point mass with angle of attack and pitch rate dynamics, the lateral motion a first
+// order roll with coordinated turns (no sideslip). Lift, drag and pitching moment are linear in the usual terms, the
+// engines follow the throttle lever with a first order lag. The model reads the surface positions, the trim and the
+// throttle levers the module writes and provides all variables of its data definition in the units and sign
+// conventions of the simulator. It is good enough to close the loop of the control laws, not to judge handling.
+class HostFlightModel {
+ public:
+  struct InitialConditions {
+    double altitude_ft = 10000;
+    double airspeed_kn = 250;
+    double heading_deg = 0;
+    double weight_kg = 40000;
+    double latitude_deg = 47.26;
+    double longitude_deg = 11.34;
+    double flapsHandleIndex = 0;
+    bool isGearDown = false;
+  };
+
+  // sets a trimmed level flight and the variables of systems that do not run on the host
+  void initialize(HostSimulation& simulation, const InitialConditions& conditions);
+
+  // advances the simulation time by the sample time with the current inputs of the module
+  void update(HostSimulation& simulation, double sampleTime);
+
+ private:
+  // state in aircraft axes: pitch and rates positive nose up, bank and roll rate positive right wing down
+  double simulationTime = 0;
+  double altitude = 0;
+  double latitude = 0;
+  double longitude = 0;
+  double trueAirspeed = 0;
+  double flightPathAngle = 0;
+  double heading = 0;
+  double angleOfAttack = 0;
+  double pitchRate = 0;
+  double bank = 0;
+  double rollRate = 0;
+  double mass = 0;
+  double flapsAngle = 0;
+  double gearPosition = 0;
+  double engineN1[2] = {};
+  double engineElapsedTime[2] = {};
+
+  // derived values of the last step for the variables
+  double loadFactor = 1;
+  double longitudinalAcceleration = 0;
+  double normalAcceleration = 0;
+  double pitchAcceleration = 0;
+  double rollAcceleration = 0;
+  double thrust[2] = {};
+
+  void step(HostSimulation& simulation, double dt);
+  void writeSimVars(HostSimulation& simulation) const;
+};
@@ -0,0 +1,187 @@
+#include "HostScenario.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace std;
+
+static string trim(const string& value) {
+  auto first = value.find_first_not_of(" \t\r");
+  if (first == string::npos) {
+    return "";
+  }
+  return value.substr(first, value.find_last_not_of(" \t\r") - first + 1);
+}
+
+static bool parseNumber(const string& value, double& number) {
+  try {
+    size_t end = 0;
+    number = stod(value, &end);
+    return end == value.size();
+  } catch (const exception&) {
+    return false;
+  }
+}
+
+bool HostScenario::load(const string& path, string& error) {
+  ifstream file(path);
+  if (!file) {
+    error = "Failed to open scenario '" + path + "'";
+    return false;
+  }
+
+  string line;
+  size_t lineNumber = 0;
+  while (getline(file, line)) {
+    lineNumber++;
+    auto comment = line.find('#');
+    if (comment != string::npos) {
+      line.resize(comment);
+    }
+    if (trim(line).empty()) {
+      continue;
+    }
+
+    vector<string> values;
+    stringstream lineStream(line);
+    string value;
+    while (getline(lineStream, value, ',')) {
+      values.push_back(trim(value));
+    }
+
+    auto prefix = path + ":" + to_string(lineNumber) + ": ";
+    Action action = {};
+    action.line = lineNumber;
+    if (values.size() < 3 || !parseNumber(values[0], action.time)) {
+      error = prefix + "Expected time, action and name";
+      return false;
+    }
+    action.name = values[2];
+    for (size_t i = 3; i < values.size(); i++) {
+      double number;
+      if (!parseNumber(values[i], number)) {
+        error = prefix + "Value '" + values[i] + "' is not a number";
+        return false;
+      }
+      action.values.push_back(number);
+    }
+
+    const auto& type = values[1];
+    size_t expectedValues = 1;
+    if (type == "init") {
+      if (action.values.size() != 1 || !setInitialCondition(action.name, action.values[0])) {
+        error = prefix + "Unknown initial condition '" + action.name + "' or value missing";
+        return false;
+      }
+      continue;
+    } else if (type == "event") {
+      action.type = ACTION_TYPE_EVENT;
+      expectedValues = action.values.empty() ? 0 : 1;
+    } else if (type == "lvar") {
+      action.type = ACTION_TYPE_LVAR;
+    } else if (type == "simvar") {
+      action.type = ACTION_TYPE_SIMVAR;
+    } else if (type == "expect_lvar") {
+      action.type = ACTION_TYPE_EXPECT_LVAR;
+      expectedValues = 2;
+    } else if (type == "expect_simvar") {
+      action.type = ACTION_TYPE_EXPECT_SIMVAR;
+      expectedValues = 2;
+    } else {
+      error = prefix + "Unknown action '" + type + "'";
+      return false;
+    }
+    if (action.values.size() != expectedValues) {
+      error = prefix + "Action '" + type + "' expects " + to_string(expectedValues) + " value(s)";
+      return false;
+    }
+    actions.push_back(action);
+  }
+
+  // actions of the same time keep the order of the file
+  stable_sort(actions.begin(), actions.end(), [](const Action& a, const Action& b) { return a.time < b.time; });
+  return true;
+}
+
+const HostFlightModel::InitialConditions& HostScenario::getInitialConditions() const {
+  return initialConditions;
+}
+
+double HostScenario::getDuration() const {
+  return actions.empty() ? 0 : actions.back().time;
+}
+
+bool HostScenario::update(HostSimulation& simulation, double time, bool verbose) {
+  bool result = true;
+  for (; nextAction < actions.size() && actions[nextAction].time <= time; nextAction++) {
+    const auto& action = actions[nextAction];
+    switch (action.type) {
+      case ACTION_TYPE_EVENT:
+        if (!simulation.sendEvent(action.name, action.values.empty() ? 0 : static_cast<long>(action.values[0]))) {
+          failures.push_back("line " + to_string(action.line) + ": event '" + action.name + "' is not mapped by the module");
+          result = false;
+        }
+        break;
+
+      case ACTION_TYPE_LVAR:
+        simulation.setNamedVariable(action.name, action.values[0]);
+        break;
+
+      case ACTION_TYPE_SIMVAR:
+        simulation.setSimVar(action.name, action.values[0]);
+        break;
+
+      case ACTION_TYPE_EXPECT_LVAR:
+      case ACTION_TYPE_EXPECT_SIMVAR: {
+        auto value = action.type == ACTION_TYPE_EXPECT_LVAR ? simulation.getNamedVariable(action.name) : simulation.getSimVar(action.name);
+        auto isOk = value >= action.values[0] && value <= action.values[1];
+        stringstream message;
+        message << "line " << action.line << ": at " << time << " s " << action.name << " = " << value << ", expected "
+                << action.values[0] << " to " << action.values[1];
+        numberOfExpectations++;
+        if (!isOk) {
+          failures.push_back(message.str());
+          result = false;
+        }
+        if (verbose || !isOk) {
+          cout << (isOk ? "PASS " : "FAIL ") << message.str() << endl;
+        }
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+size_t HostScenario::getNumberOfExpectations() const {
+  return numberOfExpectations;
+}
+
+const vector<string>& HostScenario::getFailures() const {
+  return failures;
+}
+
+bool HostScenario::setInitialCondition(const string& name, double value) {
+  if (name == "altitude_ft") {
+    initialConditions.altitude_ft = value;
+  } else if (name == "airspeed_kn") {
+    initialConditions.airspeed_kn = value;
+  } else if (name == "heading_deg") {
+    initialConditions.heading_deg = value;
+  } else if (name == "weight_kg") {
+    initialConditions.weight_kg = value;
+  } else if (name == "latitude_deg") {
+    initialConditions.latitude_deg = value;
+  } else if (name == "longitude_deg") {
+    initialConditions.longitude_deg = value;
+  } else if (name == "flaps") {
+    initialConditions.flapsHandleIndex = value;
+  } else if (name == "gear") {
+    initialConditions.isGearDown = value != 0;
+  } else {
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "HostFlightModel.h"
+#include "HostSimulation.h"
+
+// Scripted scenario of a closed loop run.
+//
+// A scenario is a text file with one action per line, values separated by commas and comments starting with '#':
+//
+//   <time>, init, <altitude_ft | airspeed_kn | heading_deg | weight_kg | latitude_deg | longitude_deg | flaps | gear>, <value>
+//   <time>, event, <name>[, <data>]
+//   <time>, lvar, <name>, <value>
+//   <time>, simvar, <name>, <value>
+//   <time>, expect_lvar, <name>, <min>, <max>
+//   <time>, expect_simvar, <name>, <min>, <max>
+//
+// Times are seconds of simulation time, init lines set the initial conditions and ignore their time. Events are sent
+// like the simulator sends them, variables set like the instruments or the scenery would set them. Expectations check
+// that a variable is within the range at their time.
+class HostScenario {
+ public:
+  // reads the scenario, fails with a message for unknown actions or wrong values
+  bool load(const std::string& path, std::string& error);
+
+  const HostFlightModel::InitialConditions& getInitialConditions() const;
+
+  // time of the last action
+  double getDuration() const;
+
+  // executes the actions that are due at the simulation time, returns false if an expectation failed or an event
+  // was not mapped by the module
+  bool update(HostSimulation& simulation, double time, bool verbose);
+
+  size_t getNumberOfExpectations() const;
+  const std::vector<std::string>& getFailures() const;
+
+ private:
+  enum ActionType {
+    ACTION_TYPE_EVENT,
+    ACTION_TYPE_LVAR,
+    ACTION_TYPE_SIMVAR,
+    ACTION_TYPE_EXPECT_LVAR,
+    ACTION_TYPE_EXPECT_SIMVAR,
+  };
+
+  struct Action {
+    size_t line;
+    double time;
+    ActionType type;
+    std::string name;
+    std::vector<double> values;
+  };
+
+  HostFlightModel::InitialConditions initialConditions;
+  std::vector<Action> actions;
+  size_t nextAction = 0;
+  size_t numberOfExpectations = 0;
+  std::vector<std::string> failures;
+
+  bool setInitialCondition(const std::string& name, double value);
+};
@@ -0,0 +1,666 @@
+#include "HostSimulation.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+using namespace std;
+
+HostSimulation& HostSimulation::get() {
+  static HostSimulation simulation;
+  return simulation;
+}
+
+double HostSimulation::getSimVar(const string& name) const {
+  auto it = simVars.find(name);
+  return it != simVars.end() ? it->second : 0.0;
+}
+
+void HostSimulation::setSimVar(const string& name, double value) {
+  simVars[name] = value;
+}
+
+int HostSimulation::getNamedVariableId(const string& name) {
+  auto it = namedVariableIds.find(name);
+  if (it != namedVariableIds.end()) {
+    return it->second;
+  }
+  auto id = static_cast<int>(namedVariableNames.size());
+  namedVariableNames.push_back(name);
+  namedVariableValues.push_back(0.0);
+  namedVariableIds.emplace(name, id);
+  return id;
+}
+
+double HostSimulation::getNamedVariable(const string& name) {
+  return getNamedVariable(getNamedVariableId(name));
+}
+
+void HostSimulation::setNamedVariable(const string& name, double value) {
+  setNamedVariable(getNamedVariableId(name), value);
+}
+
+double HostSimulation::getNamedVariable(int id) const {
+  return id >= 0 && static_cast<size_t>(id) < namedVariableValues.size() ? namedVariableValues[id] : 0.0;
+}
+
+void HostSimulation::setNamedVariable(int id, double value) {
+  if (id >= 0 && static_cast<size_t>(id) < namedVariableValues.size()) {
+    namedVariableValues[id] = value;
+  }
+}
+
+bool HostSimulation::sendEvent(const string& name, long data) {
+  auto it = eventIds.find(name);
+  if (it == eventIds.end()) {
+    return false;
+  }
+  vector<uint64_t> message((sizeof(SIMCONNECT_RECV_EVENT) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  auto event = reinterpret_cast<SIMCONNECT_RECV_EVENT*>(message.data());
+  event->dwSize = sizeof(SIMCONNECT_RECV_EVENT);
+  event->dwID = SIMCONNECT_RECV_ID_EVENT;
+  event->uGroupID = 0;
+  event->uEventID = it->second;
+  // the simulator passes 32 bit values, sign extended to the width of DWORD (see SimConnect.h)
+  event->dwData = static_cast<DWORD>(static_cast<int32_t>(data));
+  messages.push_back(std::move(message));
+  return true;
+}
+
+const map<string, uint64_t>& HostSimulation::getHtmlEvents() const {
+  return htmlEvents;
+}
+
+void HostSimulation::setVerbose(bool isVerbose) {
+  verbose = isVerbose;
+}
+
+// calculator code -----------------------------------------------------------------------------------------------------
+
+static vector<string> tokenizeCalculatorCode(const string& code) {
+  vector<string> tokens;
+  size_t i = 0;
+  while (i < code.size()) {
+    if (isspace(static_cast<unsigned char>(code[i]))) {
+      i++;
+      continue;
+    }
+    auto end = code[i] == '(' ? code.find(')', i) : i;
+    if (code[i] == '(') {
+      end = end == string::npos ? code.size() : end + 1;
+    } else {
+      while (end < code.size() && !isspace(static_cast<unsigned char>(code[end]))) {
+        end++;
+      }
+    }
+    tokens.push_back(code.substr(i, end - i));
+    i = end;
+  }
+  return tokens;
+}
+
+// name of a variable or event in parentheses without unit, like "L:NAME" for "(L:NAME, bool)"
+static string getCalculatorVariable(const string& token) {
+  auto name = token.substr(1, token.size() - 2);
+  auto comma = name.find(',');
+  if (comma != string::npos) {
+    name.resize(comma);
+  }
+  while (!name.empty() && isspace(static_cast<unsigned char>(name.back()))) {
+    name.pop_back();
+  }
+  return name;
+}
+
+bool HostSimulation::executeCalculatorCode(const string& code, double* result) {
+  auto tokens = tokenizeCalculatorCode(code);
+  vector<double> stack;
+  size_t position = 0;
+  if (!executeCalculatorTokens(tokens, position, false, stack)) {
+    cerr << "HOST: Unsupported calculator code: " << code << endl;
+    return false;
+  }
+  if (result) {
+    *result = stack.empty() ? 0.0 : stack.back();
+  }
+  return true;
+}
+
+bool HostSimulation::executeCalculatorTokens(const vector<string>& tokens, size_t& position, bool isSkipping, vector<double>& stack) {
+  auto pop = [&stack]() {
+    if (stack.empty()) {
+      return 0.0;
+    }
+    auto value = stack.back();
+    stack.pop_back();
+    return value;
+  };
+
+  while (position < tokens.size()) {
+    const auto& token = tokens[position++];
+    if (token == "}") {
+      return true;
+    }
+    if (token == "if{") {
+      auto condition = isSkipping ? false : pop() != 0.0;
+      if (!executeCalculatorTokens(tokens, position, isSkipping || !condition, stack)) {
+        return false;
+      }
+      if (position < tokens.size() && tokens[position] == "els{") {
+        position++;
+        if (!executeCalculatorTokens(tokens, position, isSkipping || condition, stack)) {
+          return false;
+        }
+      }
+      continue;
+    }
+    if (isSkipping) {
+      continue;
+    }
+
+    // variables and events
+    if (token.front() == '(') {
+      auto variable = getCalculatorVariable(token);
+      auto isWrite = !variable.empty() && variable.front() == '>';
+      if (isWrite) {
+        variable.erase(0, 1);
+      }
+      if (variable.size() < 2 || variable[1] != ':') {
+        return false;
+      }
+      auto name = variable.substr(2);
+      switch (variable.front()) {
+        case 'A':
+          if (isWrite) {
+            setSimVar(name, pop());
+          } else {
+            stack.push_back(getSimVar(name));
+          }
+          break;
+        case 'L':
+          if (isWrite) {
+            setNamedVariable(name, pop());
+          } else {
+            stack.push_back(getNamedVariable(name));
+          }
+          break;
+        case 'H':
+          htmlEvents[name]++;
+          if (verbose) {
+            cout << "HOST: H:" << name << endl;
+          }
+          break;
+        case 'K': {
+          // key events with parameters are written as K:<count>:NAME
+          size_t count = 1;
+          if (!name.empty() && isdigit(static_cast<unsigned char>(name.front())) && name.find(':') != string::npos) {
+            count = stoul(name.substr(0, name.find(':')));
+            name = name.substr(name.find(':') + 1);
+          }
+          vector<double> parameters(min(count, stack.size()));
+          for (size_t i = parameters.size(); i > 0; i--) {
+            parameters[i - 1] = pop();
+          }
+          handleKeyEvent(name, parameters);
+          break;
+        }
+        default:
+          return false;
+      }
+      continue;
+    }
+
+    // numbers
+    char* end = nullptr;
+    auto number = strtod(token.c_str(), &end);
+    if (end && *end == '\0') {
+      stack.push_back(number);
+      continue;
+    }
+
+    // operators
+    if (token == "!" || token == "not") {
+      stack.push_back(pop() == 0.0 ? 1.0 : 0.0);
+      continue;
+    }
+    if (token == "abs") {
+      stack.push_back(fabs(pop()));
+      continue;
+    }
+    if (token == "neg") {
+      stack.push_back(-pop());
+      continue;
+    }
+    auto b = pop();
+    auto a = pop();
+    if (token == "+") {
+      stack.push_back(a + b);
+    } else if (token == "-") {
+      stack.push_back(a - b);
+    } else if (token == "*") {
+      stack.push_back(a * b);
+    } else if (token == "/") {
+      stack.push_back(b != 0.0 ? a / b : 0.0);
+    } else if (token == "%") {
+      stack.push_back(b != 0.0 ? fmod(a, b) : 0.0);
+    } else if (token == "==") {
+      stack.push_back(a == b ? 1.0 : 0.0);
+    } else if (token == "!=") {
+      stack.push_back(a != b ? 1.0 : 0.0);
+    } else if (token == "<") {
+      stack.push_back(a < b ? 1.0 : 0.0);
+    } else if (token == ">") {
+      stack.push_back(a > b ? 1.0 : 0.0);
+    } else if (token == "<=") {
+      stack.push_back(a <= b ? 1.0 : 0.0);
+    } else if (token == ">=") {
+      stack.push_back(a >= b ? 1.0 : 0.0);
+    } else if (token == "&&" || token == "and") {
+      stack.push_back(a != 0.0 && b != 0.0 ? 1.0 : 0.0);
+    } else if (token == "||" || token == "or") {
+      stack.push_back(a != 0.0 || b != 0.0 ? 1.0 : 0.0);
+    } else if (token == "min") {
+      stack.push_back(min(a, b));
+    } else if (token == "max") {
+      stack.push_back(max(a, b));
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+void HostSimulation::handleKeyEvent(const string& name, const vector<double>& parameters) {
+  if (verbose) {
+    cout << "HOST: K:" << name << endl;
+  }
+  // the selected altitude is the last parameter, the first one (if any) is the index of the variable
+  if (name == "AP_ALT_VAR_SET_ENGLISH" && !parameters.empty()) {
+    setSimVar("AUTOPILOT ALTITUDE LOCK VAR:3", parameters.back());
+  }
+}
+
+// SimConnect ----------------------------------------------------------------------------------------------------------
+
+HRESULT HostSimulation::open(HANDLE* handle) {
+  isOpen = true;
+  *handle = this;
+  return S_OK;
+}
+
+HRESULT HostSimulation::close() {
+  isOpen = false;
+  dataDefinitions.clear();
+  eventIds.clear();
+  eventNames.clear();
+  clientData.clear();
+  messages.clear();
+  return S_OK;
+}
+
+HRESULT HostSimulation::getNextDispatch(SIMCONNECT_RECV** data, DWORD* size) {
+  if (!isOpen || messages.empty()) {
+    return E_FAIL;
+  }
+  currentMessage.swap(messages.front());
+  messages.pop_front();
+  *data = reinterpret_cast<SIMCONNECT_RECV*>(currentMessage.data());
+  *size = (*data)->dwSize;
+  return S_OK;
+}
+
+HRESULT HostSimulation::addToDataDefinition(SIMCONNECT_DATA_DEFINITION_ID defineId, const char* name, SIMCONNECT_DATATYPE type) {
+  switch (type) {
+    case SIMCONNECT_DATATYPE_INT32:
+    case SIMCONNECT_DATATYPE_INT64:
+    case SIMCONNECT_DATATYPE_FLOAT32:
+    case SIMCONNECT_DATATYPE_FLOAT64:
+    case SIMCONNECT_DATATYPE_LATLONALT:
+    case SIMCONNECT_DATATYPE_XYZ:
+      dataDefinitions[defineId].push_back({name, type});
+      return S_OK;
+
+    default:
+      cerr << "HOST: Unsupported data type of '" << name << "'" << endl;
+      return E_FAIL;
+  }
+}
+
+// member names of the struct types
+static const char* const XYZ_MEMBERS[] = {".x", ".y", ".z"};
+static const char* const LATLONALT_MEMBERS[] = {".Latitude", ".Longitude", ".Altitude"};
+
+HRESULT HostSimulation::requestData(SIMCONNECT_DATA_REQUEST_ID requestId, SIMCONNECT_DATA_DEFINITION_ID defineId) {
+  auto it = dataDefinitions.find(defineId);
+  if (it == dataDefinitions.end()) {
+    return E_FAIL;
+  }
+
+  // pack the variables like the simulator, without padding
+  vector<unsigned char> data;
+  auto append = [&data](const void* value, size_t size) {
+    auto bytes = static_cast<const unsigned char*>(value);
+    data.insert(data.end(), bytes, bytes + size);
+  };
+  for (const auto& datum : it->second) {
+    switch (datum.type) {
+      case SIMCONNECT_DATATYPE_INT32: {
+        auto value = static_cast<int32_t>(llround(getSimVar(datum.name)));
+        append(&value, sizeof(value));
+        break;
+      }
+      case SIMCONNECT_DATATYPE_INT64: {
+        auto value = static_cast<int64_t>(llround(getSimVar(datum.name)));
+        append(&value, sizeof(value));
+        break;
+      }
+      case SIMCONNECT_DATATYPE_FLOAT32: {
+        auto value = static_cast<float>(getSimVar(datum.name));
+        append(&value, sizeof(value));
+        break;
+      }
+      case SIMCONNECT_DATATYPE_FLOAT64: {
+        auto value = getSimVar(datum.name);
+        append(&value, sizeof(value));
+        break;
+      }
+      default: {
+        auto members = datum.type == SIMCONNECT_DATATYPE_XYZ ? XYZ_MEMBERS : LATLONALT_MEMBERS;
+        for (size_t i = 0; i < 3; i++) {
+          auto value = getSimVar(datum.name + members[i]);
+          append(&value, sizeof(value));
+        }
+        break;
+      }
+    }
+  }
+  queueSimObjectData(SIMCONNECT_RECV_ID_SIMOBJECT_DATA, requestId, defineId, data.data(), data.size());
+  return S_OK;
+}
+
+HRESULT HostSimulation::setData(SIMCONNECT_DATA_DEFINITION_ID defineId, DWORD size, const void* data) {
+  auto it = dataDefinitions.find(defineId);
+  if (it == dataDefinitions.end()) {
+    return E_FAIL;
+  }
+
+  auto bytes = static_cast<const unsigned char*>(data);
+  size_t offset = 0;
+  auto read = [&](void* value, size_t valueSize) {
+    if (offset + valueSize > size) {
+      return false;
+    }
+    memcpy(value, bytes + offset, valueSize);
+    offset += valueSize;
+    return true;
+  };
+  for (const auto& datum : it->second) {
+    switch (datum.type) {
+      case SIMCONNECT_DATATYPE_INT32: {
+        int32_t value;
+        if (!read(&value, sizeof(value))) {
+          return E_FAIL;
+        }
+        setSimVar(datum.name, value);
+        break;
+      }
+      case SIMCONNECT_DATATYPE_INT64: {
+        int64_t value;
+        if (!read(&value, sizeof(value))) {
+          return E_FAIL;
+        }
+        setSimVar(datum.name, static_cast<double>(value));
+        break;
+      }
+      case SIMCONNECT_DATATYPE_FLOAT32: {
+        float value;
+        if (!read(&value, sizeof(value))) {
+          return E_FAIL;
+        }
+        setSimVar(datum.name, value);
+        break;
+      }
+      case SIMCONNECT_DATATYPE_FLOAT64: {
+        double value;
+        if (!read(&value, sizeof(value))) {
+          return E_FAIL;
+        }
+        setSimVar(datum.name, value);
+        break;
+      }
+      default: {
+        auto members = datum.type == SIMCONNECT_DATATYPE_XYZ ? XYZ_MEMBERS : LATLONALT_MEMBERS;
+        for (size_t i = 0; i < 3; i++) {
+          double value;
+          if (!read(&value, sizeof(value))) {
+            return E_FAIL;
+          }
+          setSimVar(datum.name + members[i], value);
+        }
+        break;
+      }
+    }
+  }
+  return S_OK;
+}
+
+HRESULT HostSimulation::mapEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* name) {
+  eventIds[name] = eventId;
+  eventNames[eventId] = name;
+  return S_OK;
+}
+
+HRESULT HostSimulation::transmitEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, DWORD data) {
+  auto it = eventNames.find(eventId);
+  if (it == eventNames.end()) {
+    return E_FAIL;
+  }
+  if (verbose) {
+    cout << "HOST: Event " << it->second << " " << static_cast<int32_t>(data) << endl;
+  }
+  // the default autopilot is not simulated, the simulation rate stays at 1
+  if (it->second == "AUTOPILOT_OFF") {
+    setSimVar("AUTOPILOT MASTER", 0);
+  }
+  return S_OK;
+}
+
+HRESULT HostSimulation::createClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size) {
+  clientData[clientDataId].data.assign(size, 0);
+  return S_OK;
+}
+
+HRESULT HostSimulation::requestClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId,
+                                          SIMCONNECT_DATA_REQUEST_ID requestId,
+                                          SIMCONNECT_CLIENT_DATA_PERIOD period) {
+  auto it = clientData.find(clientDataId);
+  if (it == clientData.end()) {
+    return E_FAIL;
+  }
+  it->second.requestId = requestId;
+  it->second.isRequestedOnSet = period == SIMCONNECT_CLIENT_DATA_PERIOD_ON_SET;
+  if (period == SIMCONNECT_CLIENT_DATA_PERIOD_ONCE) {
+    queueSimObjectData(SIMCONNECT_RECV_ID_CLIENT_DATA, requestId, clientDataId, it->second.data.data(), it->second.data.size());
+  }
+  return S_OK;
+}
+
+HRESULT HostSimulation::setClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size, const void* data) {
+  auto it = clientData.find(clientDataId);
+  if (it == clientData.end() || size > it->second.data.size()) {
+    return E_FAIL;
+  }
+  memcpy(it->second.data.data(), data, size);
+  if (it->second.isRequestedOnSet) {
+    queueSimObjectData(SIMCONNECT_RECV_ID_CLIENT_DATA, it->second.requestId, clientDataId, it->second.data.data(), it->second.data.size());
+  }
+  return S_OK;
+}
+
+void HostSimulation::queueSimObjectData(SIMCONNECT_RECV_ID id,
+                                        SIMCONNECT_DATA_REQUEST_ID requestId,
+                                        DWORD defineId,
+                                        const void* data,
+                                        size_t size) {
+  // the data replaces the dwData member at the end of the struct
+  auto headerSize = sizeof(SIMCONNECT_RECV_SIMOBJECT_DATA) - sizeof(DWORD);
+  vector<uint64_t> message((headerSize + max(size, sizeof(DWORD)) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+  auto header = reinterpret_cast<SIMCONNECT_RECV_SIMOBJECT_DATA*>(message.data());
+  header->dwSize = static_cast<DWORD>(headerSize + size);
+  header->dwID = id;
+  header->dwRequestID = requestId;
+  header->dwObjectID = SIMCONNECT_OBJECT_ID_USER;
+  header->dwDefineID = defineId;
+  header->dwentrynumber = 1;
+  header->dwoutof = 1;
+  header->dwDefineCount = 1;
+  memcpy(reinterpret_cast<unsigned char*>(message.data()) + headerSize, data, size);
+  messages.push_back(std::move(message));
+}
+
+// gauge api -----------------------------------------------------------------------------------------------------------
+
+ID register_named_variable(PCSTRINGZ name) {
+  return HostSimulation::get().getNamedVariableId(name);
+}
+
+FLOAT64 get_named_variable_value(ID id) {
+  return HostSimulation::get().getNamedVariable(id);
+}
+
+void set_named_variable_value(ID id, FLOAT64 value) {
+  HostSimulation::get().setNamedVariable(id, value);
+}
+
+void unregister_all_named_vars() {
+  // values are kept, the variables of the scenario outlive the module
+}
+
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* fvalue, SINT32* ivalue, PCSTRINGZ* svalue) {
+  double result = 0;
+  auto isOk = HostSimulation::get().executeCalculatorCode(code, &result);
+  if (fvalue) {
+    *fvalue = result;
+  }
+  if (ivalue) {
+    *ivalue = static_cast<SINT32>(result);
+  }
+  if (svalue) {
+    *svalue = "";
+  }
+  return isOk ? TRUE : FALSE;
+}
+
+BOOL register_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {
+  // key events are not generated by the host
+  return TRUE;
+}
+
+BOOL unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER, PVOID) {
+  return TRUE;
+}
+
+// simconnect api ------------------------------------------------------------------------------------------------------
+
+HRESULT SimConnect_Open(HANDLE* phSimConnect, const char*, void*, DWORD, HANDLE, DWORD) {
+  return HostSimulation::get().open(phSimConnect);
+}
+
+HRESULT SimConnect_Close(HANDLE) {
+  return HostSimulation::get().close();
+}
+
+HRESULT SimConnect_GetNextDispatch(HANDLE, SIMCONNECT_RECV** ppData, DWORD* pcbData) {
+  return HostSimulation::get().getNextDispatch(ppData, pcbData);
+}
+
+HRESULT SimConnect_AddToDataDefinition(HANDLE,
+                                       SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                       const char* DatumName,
+                                       const char*,
+                                       SIMCONNECT_DATATYPE DatumType,
+                                       float,
+                                       DWORD) {
+  return HostSimulation::get().addToDataDefinition(DefineID, DatumName, DatumType);
+}
+
+HRESULT SimConnect_RequestDataOnSimObject(HANDLE,
+                                          SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                          SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                          SIMCONNECT_OBJECT_ID,
+                                          SIMCONNECT_PERIOD,
+                                          SIMCONNECT_DATA_REQUEST_FLAG,
+                                          DWORD,
+                                          DWORD,
+                                          DWORD) {
+  // every request is answered once, the module requests the data each frame
+  return HostSimulation::get().requestData(RequestID, DefineID);
+}
+
+HRESULT SimConnect_SetDataOnSimObject(HANDLE,
+                                      SIMCONNECT_DATA_DEFINITION_ID DefineID,
+                                      SIMCONNECT_OBJECT_ID,
+                                      SIMCONNECT_DATA_SET_FLAG,
+                                      DWORD,
+                                      DWORD cbUnitSize,
+                                      void* pDataSet) {
+  return HostSimulation::get().setData(DefineID, cbUnitSize, pDataSet);
+}
+
+HRESULT SimConnect_MapClientEventToSimEvent(HANDLE, SIMCONNECT_CLIENT_EVENT_ID EventID, const char* EventName) {
+  return HostSimulation::get().mapEvent(EventID, EventName);
+}
+
+HRESULT SimConnect_AddClientEventToNotificationGroup(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, SIMCONNECT_CLIENT_EVENT_ID, BOOL) {
+  // every mapped event is delivered, there is no other client to mask events from
+  return S_OK;
+}
+
+HRESULT SimConnect_SetNotificationGroupPriority(HANDLE, SIMCONNECT_NOTIFICATION_GROUP_ID, DWORD) {
+  return S_OK;
+}
+
+HRESULT SimConnect_TransmitClientEvent(HANDLE,
+                                       SIMCONNECT_OBJECT_ID,
+                                       SIMCONNECT_CLIENT_EVENT_ID EventID,
+                                       DWORD dwData,
+                                       SIMCONNECT_NOTIFICATION_GROUP_ID,
+                                       SIMCONNECT_EVENT_FLAG) {
+  return HostSimulation::get().transmitEvent(EventID, dwData);
+}
+
+HRESULT SimConnect_MapClientDataNameToID(HANDLE, const char*, SIMCONNECT_CLIENT_DATA_ID) {
+  return S_OK;
+}
+
+HRESULT SimConnect_CreateClientData(HANDLE, SIMCONNECT_CLIENT_DATA_ID ClientDataID, DWORD dwSize, SIMCONNECT_CREATE_CLIENT_DATA_FLAG) {
+  return HostSimulation::get().createClientData(ClientDataID, dwSize);
+}
+
+HRESULT SimConnect_AddToClientDataDefinition(HANDLE, SIMCONNECT_CLIENT_DATA_DEFINITION_ID, DWORD, DWORD, float, DWORD) {
+  // client data is copied as a whole, the layout of the members is not needed
+  return S_OK;
+}
+
+HRESULT SimConnect_RequestClientData(HANDLE,
+                                     SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                     SIMCONNECT_DATA_REQUEST_ID RequestID,
+                                     SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                     SIMCONNECT_CLIENT_DATA_PERIOD Period,
+                                     SIMCONNECT_CLIENT_DATA_REQUEST_FLAG,
+                                     DWORD,
+                                     DWORD,
+                                     DWORD) {
+  return HostSimulation::get().requestClientData(ClientDataID, RequestID, Period);
+}
+
+HRESULT SimConnect_SetClientData(HANDLE,
+                                 SIMCONNECT_CLIENT_DATA_ID ClientDataID,
+                                 SIMCONNECT_CLIENT_DATA_DEFINITION_ID,
+                                 SIMCONNECT_CLIENT_DATA_SET_FLAG,
+                                 DWORD,
+                                 DWORD cbUnitSize,
+                                 void* pDataSet) {
+  return HostSimulation::get().setClientData(ClientDataID, cbUnitSize, pDataSet);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SimConnect.h>
+
+// In-memory stand-in for the simulator behind the gauge and SimConnect APIs of the fly-by-wire module.
+//
+// Simulation variables are stored by the name the module uses in its data definitions (e.g. "PLANE PITCH DEGREES" or
+// "TURB ENG N1:1") in the unit of that definition. Struct members are stored with the member as suffix, like
+// "STRUCT BODY ROTATION VELOCITY.x" or "NAV GS LATLONALT:3.Latitude". Requested data is packed from these variables,
+// data set on the user object is written back to them. Events sent by the scenario are delivered through the dispatch
+// queue with the ids the module mapped them to. Everything runs on the calling thread, there is no timing.
+class HostSimulation {
+ public:
+  static HostSimulation& get();
+
+  // simulation variables (A:)
+  double getSimVar(const std::string& name) const;
+  void setSimVar(const std::string& name, double value);
+
+  // named variables (L:)
+  int getNamedVariableId(const std::string& name);
+  double getNamedVariable(const std::string& name);
+  void setNamedVariable(const std::string& name, double value);
+  double getNamedVariable(int id) const;
+  void setNamedVariable(int id, double value);
+
+  // sends a sim event like the simulator does when it is triggered, fails if the module did not map it
+  bool sendEvent(const std::string& name, long data);
+
+  // executes calculator code, only the subset used by the module is understood: variables (A:, L:), numbers,
+  // arithmetic, comparison and logic operators, min and max, if{ } els{ } and the events (>H:) and (>K:)
+  bool executeCalculatorCode(const std::string& code, double* result);
+
+  // number of html events (>H:) sent by calculator code, they are handled by the instruments which do not run here
+  const std::map<std::string, uint64_t>& getHtmlEvents() const;
+
+  void setVerbose(bool verbose);
+
+  // SimConnect
+  HRESULT open(HANDLE* handle);
+  HRESULT close();
+  HRESULT getNextDispatch(SIMCONNECT_RECV** data, DWORD* size);
+  HRESULT addToDataDefinition(SIMCONNECT_DATA_DEFINITION_ID defineId, const char* name, SIMCONNECT_DATATYPE type);
+  HRESULT requestData(SIMCONNECT_DATA_REQUEST_ID requestId, SIMCONNECT_DATA_DEFINITION_ID defineId);
+  HRESULT setData(SIMCONNECT_DATA_DEFINITION_ID defineId, DWORD size, const void* data);
+  HRESULT mapEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, const char* name);
+  HRESULT transmitEvent(SIMCONNECT_CLIENT_EVENT_ID eventId, DWORD data);
+  HRESULT createClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size);
+  HRESULT requestClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, SIMCONNECT_DATA_REQUEST_ID requestId, SIMCONNECT_CLIENT_DATA_PERIOD period);
+  HRESULT setClientData(SIMCONNECT_CLIENT_DATA_ID clientDataId, DWORD size, const void* data);
+
+ private:
+  struct Datum {
+    std::string name;
+    SIMCONNECT_DATATYPE type;
+  };
+
+  struct ClientData {
+    std::vector<unsigned char> data;
+    bool isRequestedOnSet = false;
+    SIMCONNECT_DATA_REQUEST_ID requestId = 0;
+  };
+
+  bool isOpen = false;
+  bool verbose = false;
+
+  std::unordered_map<std::string, double> simVars;
+
+  std::vector<std::string> namedVariableNames;
+  std::vector<double> namedVariableValues;
+  std::unordered_map<std::string, int> namedVariableIds;
+
+  std::map<SIMCONNECT_DATA_DEFINITION_ID, std::vector<Datum>> dataDefinitions;
+  std::unordered_map<std::string, SIMCONNECT_CLIENT_EVENT_ID> eventIds;
+  std::map<SIMCONNECT_CLIENT_EVENT_ID, std::string> eventNames;
+  std::map<SIMCONNECT_CLIENT_DATA_ID, ClientData> clientData;
+  std::map<std::string, uint64_t> htmlEvents;
+
+  // messages are kept as 8 byte words so the structs in them are aligned, the current one stays valid until the next
+  // call of getNextDispatch()
+  std::deque<std::vector<uint64_t>> messages;
+  std::vector<uint64_t> currentMessage;
+
+  void queueSimObjectData(SIMCONNECT_RECV_ID id, SIMCONNECT_DATA_REQUEST_ID requestId, DWORD defineId, const void* data, size_t size);
+  void handleKeyEvent(const std::string& name, const std::vector<double>& parameters);
+  bool executeCalculatorTokens(const std::vector<std::string>& tokens, size_t& position, bool isSkipping, std::vector<double>& stack);
+};
@@ -0,0 +1,242 @@
+#include <ini.h>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <set>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderReader.h"
+#include "FlyByWireInterface.h"
+#include "HostFlightModel.h"
+#include "HostScenario.h"
+#include "HostSimulation.h"
+
+using namespace std;
+using namespace mINI;
+
+// variables written to the trace, in the units of the data definition
+static const char* const TRACE_SIMVARS[] = {
+    "INDICATED ALTITUDE",   "AIRSPEED INDICATED", "VELOCITY WORLD Y",      "PLANE HEADING DEGREES MAGNETIC",
+    "PLANE PITCH DEGREES",  "PLANE BANK DEGREES", "INCIDENCE ALPHA",       "G FORCE",
+    "ELEVATOR POSITION",    "AILERON POSITION",   "ELEVATOR TRIM POSITION", "GENERAL ENG THROTTLE LEVER POSITION:1",
+    "TURB ENG N1:1",
+};
+static const char* const TRACE_LVARS[] = {
+    "A32NX_AUTOPILOT_ACTIVE",
+    "A32NX_AUTOTHRUST_STATUS",
+    "A32NX_FMA_LATERAL_MODE",
+    "A32NX_FMA_VERTICAL_MODE",
+};
+
+static const char* const FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH = "\\work\\FlightDataRecorder.ini";
+
+// the module treats a simulation time below this as pause and skips the laws and the recorder, see FlyByWireInterface
+static constexpr double MODULE_PAUSE_SIMULATION_TIME = 0.2;
+
+// the recorder writes every sample within the update and records continuously, so the recordings of a run can be
+// checked against its updates, other settings of an existing configuration are kept
+static bool configureFlightDataRecorder() {
+  INIStructure iniStructure;
+  INIFile iniFile(FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH);
+  iniFile.read(iniStructure);
+  iniStructure["FLIGHT_DATA_RECORDER"]["ENABLED"] = "true";
+  iniStructure["FLIGHT_DATA_RECORDER"]["WRITE_MODE"] = "DIRECT";
+  iniStructure["FLIGHT_DATA_RECORDER"]["RECORDING_MODE"] = "CONTINUOUS";
+  return iniFile.write(iniStructure, true);
+}
+
+static set<string> getRecordings() {
+  set<string> result;
+  for (const auto& entry : filesystem::directory_iterator(".")) {
+    if (entry.path().extension() == ".fdr") {
+      result.insert(entry.path().filename().string());
+    }
+  }
+  return result;
+}
+
+// counts the samples in the recordings that were not present before the run, returns false if one is unreadable
+static bool countRecordedSamples(const set<string>& previousRecordings, uint64_t& numberOfSamples) {
+  numberOfSamples = 0;
+  auto sample = make_unique<FlightDataRecorderSample>();
+  for (const auto& filename : getRecordings()) {
+    if (previousRecordings.count(filename) > 0) {
+      continue;
+    }
+    FlightDataRecorderReader reader;
+    if (!reader.open(filename, true)) {
+      cout << "Failed to open recording '" << filename << "': " << reader.getError() << endl;
+      return false;
+    }
+    while (reader.read(*sample)) {
+      numberOfSamples++;
+    }
+    if (!reader.getError().empty()) {
+      cout << "Failed to read recording '" << filename << "': " << reader.getError() << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string scenarioFilePath;
+  string workDirectory = (filesystem::temp_directory_path() / "fbwharness").string();
+  string traceFilePath;
+  double duration = 0;
+  double sampleTime = 1.0 / 30.0;
+  double traceRate = 1;
+  bool verbose = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Runs the fly-by-wire module in closed loop with a simple flight model, driven by a scenario");
+  args.addArgument({"-s", "--scenario"}, &scenarioFilePath, "Scenario File");
+  args.addArgument({"-d", "--duration"}, &duration, "Simulation time in seconds (default: time of the last action)");
+  args.addArgument({"-t", "--sample-time"}, &sampleTime, "Sample time of the module in seconds (default: 1/30)");
+  args.addArgument({"-w", "--work-directory"}, &workDirectory, "Directory for the configuration and recordings of the module");
+  args.addArgument({"-o", "--trace"}, &traceFilePath, "CSV file with a trace of the main flight parameters");
+  args.addArgument({"-r", "--trace-rate"}, &traceRate, "Rows per second of simulation time in the trace (default: 1)");
+  args.addArgument({"-v", "--verbose"}, &verbose, "Print the passed expectations and the events of the module");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (scenarioFilePath.empty()) {
+    cout << "Scenario file parameter missing!" << endl;
+    return 1;
+  }
+  if (sampleTime <= 0 || traceRate <= 0) {
+    cout << "Sample time and trace rate must be positive!" << endl;
+    return 1;
+  }
+
+  // load scenario before changing into the work directory
+  HostScenario scenario;
+  string error;
+  if (!scenario.load(filesystem::absolute(scenarioFilePath).string(), error)) {
+    cout << error << endl;
+    return 1;
+  }
+  if (duration <= 0) {
+    duration = scenario.getDuration();
+  }
+
+  // the module uses paths like "\work\ModelConfiguration.ini", they end up as file names in the work directory
+  ofstream trace;
+  try {
+    if (!traceFilePath.empty()) {
+      traceFilePath = filesystem::absolute(traceFilePath).string();
+    }
+    filesystem::create_directories(workDirectory);
+    filesystem::current_path(workDirectory);
+  } catch (const filesystem::filesystem_error& e) {
+    cout << e.what() << endl;
+    return 1;
+  }
+  if (!traceFilePath.empty()) {
+    trace.open(traceFilePath);
+    if (!trace) {
+      cout << "Failed to open trace file '" << traceFilePath << "'!" << endl;
+      return 1;
+    }
+    trace << "time";
+    for (auto name : TRACE_SIMVARS) {
+      trace << "," << name;
+    }
+    for (auto name : TRACE_LVARS) {
+      trace << "," << name;
+    }
+    trace << endl;
+  }
+
+  // set up the recorder before the module reads its configuration
+  if (!configureFlightDataRecorder()) {
+    cout << "Failed to write '" << FLIGHT_DATA_RECORDER_CONFIGURATION_FILEPATH << "'!" << endl;
+    return 1;
+  }
+  auto previousRecordings = getRecordings();
+
+  // set up the simulation and the module
+  auto& simulation = HostSimulation::get();
+  simulation.setVerbose(verbose);
+  HostFlightModel flightModel;
+  flightModel.initialize(simulation, scenario.getInitialConditions());
+  FlyByWireInterface flyByWireInterface;
+  if (!flyByWireInterface.connect()) {
+    cout << "Failed to connect the module!" << endl;
+    return 1;
+  }
+
+  // run the loop like the simulator: module first, then the flight model with the new surface positions
+  auto numberOfSteps = static_cast<uint64_t>(ceil(duration / sampleTime - 1e-9));
+  uint64_t numberOfTraceRows = 0;
+  uint64_t numberOfRecordedUpdates = 0;
+  bool isOk = true;
+  auto startTime = chrono::steady_clock::now();
+  for (uint64_t step = 0; step <= numberOfSteps; step++) {
+    auto time = step * sampleTime;
+    isOk &= scenario.update(simulation, time + 1e-9, verbose);
+    if (trace.is_open() && time + 1e-9 >= numberOfTraceRows / traceRate) {
+      trace << time;
+      for (auto name : TRACE_SIMVARS) {
+        trace << "," << simulation.getSimVar(name);
+      }
+      for (auto name : TRACE_LVARS) {
+        trace << "," << simulation.getNamedVariable(name);
+      }
+      trace << "\n";
+      numberOfTraceRows++;
+    }
+    if (step == numberOfSteps) {
+      break;
+    }
+    if (simulation.getSimVar("SIMULATION TIME") >= MODULE_PAUSE_SIMULATION_TIME) {
+      numberOfRecordedUpdates++;
+    }
+    if (!flyByWireInterface.update(sampleTime)) {
+      cout << "Update of the module failed at " << time << " s!" << endl;
+      isOk = false;
+      break;
+    }
+    flightModel.update(simulation, sampleTime);
+  }
+  auto wallTime = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+  flyByWireInterface.disconnect();
+
+  // every update of the module outside of pause records one sample
+  uint64_t numberOfRecordedSamples = 0;
+  auto isRecordingOk =
+      countRecordedSamples(previousRecordings, numberOfRecordedSamples) && numberOfRecordedSamples == numberOfRecordedUpdates;
+  isOk &= isRecordingOk;
+
+  // print summary
+  cout << "Simulated " << numberOfSteps * sampleTime << " s in " << wallTime << " s ("
+       << (wallTime > 0 ? numberOfSteps * sampleTime / wallTime : 0) << "x real time)" << endl;
+  cout << "Expectations: " << scenario.getNumberOfExpectations() << ", failures: " << scenario.getFailures().size() << endl;
+  for (const auto& failure : scenario.getFailures()) {
+    cout << "  " << failure << endl;
+  }
+  cout << "Recorded samples: " << numberOfRecordedSamples << ", expected: " << numberOfRecordedUpdates
+       << (isRecordingOk ? "" : " (mismatch)") << endl;
+
+  return isOk ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+// Forced include of the autopilot state machine. Its generated code checks the word sizes of the 32 bit target it was
+// generated for, long is 64 bit on Linux. The model only uses the fixed width types of rtwtypes.h, so the check is
+// satisfied without changing the generated code.
+
+#include <climits>
+
+#undef ULONG_MAX
+#undef LONG_MAX
+#define ULONG_MAX (0xFFFFFFFFUL)
+#define LONG_MAX (0x7FFFFFFFL)
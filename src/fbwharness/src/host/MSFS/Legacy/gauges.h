@@ -0,0 +1,49 @@
+#pragma once
+
+// Host stand-in for the part of the MSFS gauge API used by the fly-by-wire module. Named variables and calculator
+// code are served by the in-memory HostSimulation, see HostSimulation.h.
+
+#include <cstdint>
+
+typedef double FLOAT64;
+typedef int32_t SINT32;
+typedef uint32_t UINT32;
+typedef int32_t ID;
+typedef uint32_t ID32;
+typedef void* PVOID;
+typedef const char* PCSTRINGZ;
+
+typedef int BOOL;
+
+#define TRUE 1
+#define FALSE 0
+
+// key events delivered to key event handlers
+#define KEY_ID_MIN 0x00010000
+#define KEY_AILERON_LEFT (KEY_ID_MIN + 1)
+#define KEY_AILERON_RIGHT (KEY_ID_MIN + 2)
+
+// the module calls min and max with mixed argument types like min(double, long), which compiles with the SDK headers
+// but not with the templates of the standard library alone
+inline double min(double a, double b) {
+  return a < b ? a : b;
+}
+
+inline double max(double a, double b) {
+  return a > b ? a : b;
+}
+
+typedef void (*GAUGE_KEY_EVENT_HANDLER)(ID32 event, UINT32 evdata, PVOID userdata);
+
+// named variables (L:)
+ID register_named_variable(PCSTRINGZ name);
+FLOAT64 get_named_variable_value(ID id);
+void set_named_variable_value(ID id, FLOAT64 value);
+void unregister_all_named_vars();
+
+// reverse polish calculator code, only the subset used by the module is understood
+BOOL execute_calculator_code(PCSTRINGZ code, FLOAT64* fvalue, SINT32* ivalue, PCSTRINGZ* svalue);
+
+// key events
+BOOL register_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
+BOOL unregister_key_event_handler(GAUGE_KEY_EVENT_HANDLER handler, PVOID userdata);
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "FlightDataRecorderManifest.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderTest.h"
+#include "FlightDataRecorderTestSession.h"
+
+using namespace std;
+
+static constexpr int SAMPLES_PER_FILE = 100;
+
+// records the given number of samples in one session of the recorder, all files are created within a second or two
+static void record(int numberOfSamples, int maximumNumberOfFiles, double& simulationTime) {
+  ofstream("\\work\\FlightDataRecorder.ini") << "[FLIGHT_DATA_RECORDER]\n"
+                                             << "WRITE_MODE = DIRECT\n"
+                                             << "MAXIMUM_NUMBER_OF_ENTRIES_PER_FILE = " << SAMPLES_PER_FILE << "\n"
+                                             << "MAXIMUM_NUMBER_OF_FILES = " << maximumNumberOfFiles << "\n";
+
+  auto session = make_unique<FlightDataRecorderTestSession>();
+  for (int i = 0; i < numberOfSamples; i++) {
+    session->getAutopilotStateMachineOutput().time.simulation_time = simulationTime;
+    simulationTime += 1.0 / 30.0;
+    session->update();
+  }
+  session->terminate();
+}
+
+// returns the number of samples of every recording in the work directory
+static vector<uint64_t> readRecordings() {
+  vector<uint64_t> result;
+  auto sample = make_unique<FlightDataRecorderSample>();
+  for (const auto& entry : filesystem::directory_iterator(".")) {
+    if (entry.path().extension() == ".fdr") {
+      FlightDataRecorderReader reader;
+      FDR_CHECK(reader.open(entry.path().string(), true));
+      uint64_t numberOfSamples = 0;
+      while (reader.read(*sample)) {
+        numberOfSamples++;
+      }
+      FDR_CHECK(reader.getError().empty());
+      result.push_back(numberOfSamples);
+    }
+  }
+  return result;
+}
+
+static size_t getNumberOfManifestEntries() {
+  FlightDataRecorderManifest manifest;
+  manifest.load("\\work\\FlightDataRecorder.manifest", "\\work", ".fdr");
+  return manifest.getNumberOfFiles();
+}
+
+int main() {
+  // the recorder uses paths like "\work\FlightDataRecorder.ini", they end up as file names in the work directory
+  auto workDirectory = filesystem::temp_directory_path() / "FlightDataRecorderRotationTest";
+  filesystem::remove_all(workDirectory);
+  filesystem::create_directories(workDirectory);
+  filesystem::current_path(workDirectory);
+
+  // rotations within the same second create new files instead of overwriting the previous one
+  double simulationTime = 0;
+  record(3 * SAMPLES_PER_FILE + 50, 0, simulationTime);
+  auto recordings = readRecordings();
+  FDR_CHECK(recordings.size() >= 4);
+  FDR_CHECK_EQUAL(getNumberOfManifestEntries(), recordings.size());
+  uint64_t numberOfSamples = 0;
+  for (auto count : recordings) {
+    numberOfSamples += count;
+  }
+  FDR_CHECK_EQUAL(numberOfSamples, static_cast<uint64_t>(3 * SAMPLES_PER_FILE + 50));
+
+  // a new session keeps its own file when retention removes the old ones
+  record(50, 3, simulationTime);
+  recordings = readRecordings();
+  FDR_CHECK_EQUAL(recordings.size(), 3u);
+  FDR_CHECK_EQUAL(getNumberOfManifestEntries(), 3u);
+  FDR_CHECK(find(recordings.begin(), recordings.end(), 50) != recordings.end());
+
+  return 0;
+}
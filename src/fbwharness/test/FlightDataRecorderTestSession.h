@@ -0,0 +1,33 @@
+#pragma once
+
+#include "FlightDataRecorder.h"
+
+// recorder with the models it reads from, the tests write the configuration before creating it and set the values
+// to record directly in the outputs of the state machine
+class FlightDataRecorderTestSession {
+ public:
+  FlightDataRecorderTestSession() {
+    autopilotStateMachine.initialize();
+    autopilotLaws.initialize();
+    autoThrust.initialize();
+    flyByWire.initialize();
+    recorder.initialize();
+  }
+
+  // the recorder only reads the outputs, so they are written like the model would
+  ap_sm_output& getAutopilotStateMachineOutput() { return const_cast<ap_sm_output&>(autopilotStateMachine.getExternalOutputs().out); }
+
+  FlightDataRecorder& getRecorder() { return recorder; }
+
+  void update() { recorder.update(&autopilotStateMachine, &autopilotLaws, &autoThrust, &flyByWire, engineData); }
+
+  void terminate() { recorder.terminate(); }
+
+ private:
+  AutopilotStateMachineModelClass autopilotStateMachine;
+  AutopilotLawsModelClass autopilotLaws;
+  AutothrustModelClass autoThrust;
+  FlyByWireModelClass flyByWire;
+  EngineData engineData = {};
+  FlightDataRecorder recorder;
+};
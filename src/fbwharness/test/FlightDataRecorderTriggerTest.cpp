@@ -0,0 +1,91 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderTest.h"
+#include "FlightDataRecorderTestSession.h"
+
+using namespace std;
+
+static constexpr double RATE = 30;
+static constexpr double DURATION = 40;
+static constexpr double TRIGGER_TIME = 20;
+static constexpr double PRE_TRIGGER_SECONDS = 10;
+static constexpr double POST_TRIGGER_SECONDS = 2;
+static constexpr int MAXIMUM_SAMPLES_PER_DRAIN = 4;
+
+int main() {
+  // the recorder uses paths like "\work\FlightDataRecorder.ini", they end up as file names in the work directory
+  auto workDirectory = filesystem::temp_directory_path() / "FlightDataRecorderTriggerTest";
+  filesystem::remove_all(workDirectory);
+  filesystem::create_directories(workDirectory);
+  filesystem::current_path(workDirectory);
+  ofstream("\\work\\FlightDataRecorder.ini") << "[FLIGHT_DATA_RECORDER]\n"
+                                             << "WRITE_MODE = DIRECT\n"
+                                             << "RECORDING_MODE = TRIGGERED\n"
+                                             << "BACKGROUND_RATE_HZ = 5\n"
+                                             << "PRE_TRIGGER_SECONDS = " << PRE_TRIGGER_SECONDS << "\n"
+                                             << "POST_TRIGGER_SECONDS = " << POST_TRIGGER_SECONDS << "\n"
+                                             << "PRE_TRIGGER_BUFFER_SIZE = 600\n"
+                                             << "MAXIMUM_SAMPLES_PER_DRAIN = " << MAXIMUM_SAMPLES_PER_DRAIN << "\n";
+
+  // the test sets time and trigger in the outputs directly
+  auto session = make_unique<FlightDataRecorderTestSession>();
+  auto& autopilotStateMachineOutput = session->getAutopilotStateMachineOutput();
+  auto numberOfSteps = static_cast<int>(DURATION * RATE);
+  uint64_t maximumSamplesPerUpdate = 0;
+  for (int step = 0; step < numberOfSteps; step++) {
+    autopilotStateMachineOutput.time.simulation_time = step / RATE;
+    autopilotStateMachineOutput.input.FDR_event = step >= TRIGGER_TIME * RATE && step < TRIGGER_TIME * RATE + 3;
+    auto before = session->getRecorder().getStatistics().sampleCount;
+    session->update();
+    maximumSamplesPerUpdate = max(maximumSamplesPerUpdate, session->getRecorder().getStatistics().sampleCount - before);
+  }
+  session->terminate();
+
+  // releasing the pre-trigger window costs no more than the configured samples per update and the sample itself
+  FDR_CHECK(maximumSamplesPerUpdate <= MAXIMUM_SAMPLES_PER_DRAIN + 1);
+
+  // find recording
+  string filePath;
+  for (const auto& entry : filesystem::directory_iterator(".")) {
+    if (entry.path().extension() == ".fdr") {
+      FDR_CHECK(filePath.empty());
+      filePath = entry.path().string();
+    }
+  }
+  FDR_CHECK(!filePath.empty());
+
+  // read recorded steps
+  FlightDataRecorderReader reader;
+  FDR_CHECK(reader.open(filePath, true));
+  auto sample = make_unique<FlightDataRecorderSample>();
+  vector<int> steps;
+  while (reader.read(*sample)) {
+    steps.push_back(static_cast<int>(lround(sample->ap_sm.time.simulation_time * RATE)));
+  }
+  FDR_CHECK(reader.getError().empty());
+
+  // samples are in order, every step of the pre- and post-trigger window is recorded, the rest at the background rate
+  // (a little below it, a multiple of the sample time is needed to pass the interval)
+  auto firstWindowStep = static_cast<int>((TRIGGER_TIME - PRE_TRIGGER_SECONDS) * RATE) + 1;
+  auto lastWindowStep = static_cast<int>((TRIGGER_TIME + POST_TRIGGER_SECONDS) * RATE) + 2;
+  int numberOfWindowSteps = 0;
+  int numberOfBackgroundSteps = 0;
+  for (size_t i = 0; i < steps.size(); i++) {
+    FDR_CHECK(i == 0 || steps[i] > steps[i - 1]);
+    if (steps[i] >= firstWindowStep && steps[i] <= lastWindowStep) {
+      numberOfWindowSteps++;
+    } else {
+      numberOfBackgroundSteps++;
+    }
+  }
+  FDR_CHECK_EQUAL(numberOfWindowSteps, lastWindowStep - firstWindowStep + 1);
+  auto backgroundSeconds = DURATION - PRE_TRIGGER_SECONDS - POST_TRIGGER_SECONDS;
+  FDR_CHECK(numberOfBackgroundSteps >= backgroundSeconds * 4 && numberOfBackgroundSteps <= backgroundSeconds * 5 + 4);
+
+  return 0;
+}
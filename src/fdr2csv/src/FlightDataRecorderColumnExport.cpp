@@ -0,0 +1,135 @@
+#include "FlightDataRecorderColumnExport.h"
+
+#include <cstring>
+
+using namespace std;
+
+bool FlightDataRecorderColumnExport::open(const string& path,
+                                          const vector<FlightDataRecorderSchema::Field>& exportFields,
+                                          uint64_t numberOfSamples,
+                                          uint64_t version) {
+  filePath = path;
+  fields = exportFields;
+  interfaceVersion = version;
+  capacity = numberOfSamples;
+  sampleCount = 0;
+
+  // place columns one after the other
+  uint64_t offset = 0;
+  columnOffsets.clear();
+  for (const auto& field : fields) {
+    columnOffsets.push_back(offset);
+    offset += (field.size * capacity + 7) / 8 * 8;
+  }
+
+  out.open(filePath, ios::out | ios::trunc | ios::binary);
+  if (!out.is_open()) {
+    error = "Failed to create output file!";
+    return false;
+  }
+
+  // reserve the whole file so columns can be written at their final position
+  if (offset > 0) {
+    out.seekp(static_cast<streamoff>(offset - 1));
+    out.put(0);
+  }
+  if (!out) {
+    error = "Failed to reserve output file!";
+    return false;
+  }
+  return true;
+}
+
+void FlightDataRecorderColumnExport::transpose(string& buffer,
+                                               const vector<FlightDataRecorderSchema::Field>& fields,
+                                               size_t sampleSize,
+                                               const unsigned char* samples,
+                                               size_t numberOfSamples) {
+  // samples are stored in the byte order of the host, which is little-endian on all supported platforms
+  for (const auto& field : fields) {
+    auto position = buffer.size();
+    buffer.resize(position + field.size * numberOfSamples);
+    auto column = &buffer[position];
+    for (size_t i = 0; i < numberOfSamples; i++) {
+      memcpy(column + i * field.size, samples + i * sampleSize + field.offset, field.size);
+    }
+  }
+}
+
+bool FlightDataRecorderColumnExport::write(const string& buffer, size_t numberOfSamples) {
+  if (sampleCount + numberOfSamples > capacity) {
+    error = "More samples than announced!";
+    return false;
+  }
+
+  // copy each column of the block behind the samples already written
+  size_t position = 0;
+  for (size_t i = 0; i < fields.size(); i++) {
+    auto size = fields[i].size * numberOfSamples;
+    out.seekp(static_cast<streamoff>(columnOffsets[i] + fields[i].size * sampleCount));
+    out.write(buffer.data() + position, static_cast<streamsize>(size));
+    position += size;
+  }
+  sampleCount += numberOfSamples;
+
+  if (!out) {
+    error = "Failed to write output file!";
+    return false;
+  }
+  return true;
+}
+
+bool FlightDataRecorderColumnExport::close() {
+  out.close();
+  if (out.fail()) {
+    error = "Failed to write output file!";
+    return false;
+  }
+
+  ofstream sidecar(filePath + ".json", ios::out | ios::trunc);
+  if (!sidecar.is_open()) {
+    error = "Failed to create schema file!";
+    return false;
+  }
+
+  // field paths consist of identifiers and dots, so they need no escaping
+  sidecar << "{" << endl;
+  sidecar << "  \"format\": \"fdr-columns\"," << endl;
+  sidecar << "  \"version\": 1," << endl;
+  sidecar << "  \"interface_version\": " << interfaceVersion << "," << endl;
+  sidecar << "  \"byte_order\": \"little\"," << endl;
+  sidecar << "  \"sample_count\": " << sampleCount << "," << endl;
+  sidecar << "  \"columns\": [" << endl;
+  for (size_t i = 0; i < fields.size(); i++) {
+    sidecar << "    { \"name\": \"" << fields[i].path << "\", \"type\": \"" << getTypeName(fields[i].type) << "\", \"offset\": ";
+    sidecar << columnOffsets[i] << ", \"count\": " << sampleCount << " }" << (i + 1 < fields.size() ? "," : "") << endl;
+  }
+  sidecar << "  ]" << endl;
+  sidecar << "}" << endl;
+
+  if (!sidecar) {
+    error = "Failed to write schema file!";
+    return false;
+  }
+  return true;
+}
+
+const string& FlightDataRecorderColumnExport::getError() const {
+  return error;
+}
+
+const char* FlightDataRecorderColumnExport::getTypeName(FlightDataRecorderSchema::FieldType type) {
+  switch (type) {
+    case FlightDataRecorderSchema::FIELD_TYPE_REAL:
+      return "float64";
+    case FlightDataRecorderSchema::FIELD_TYPE_BOOLEAN:
+      return "uint8";
+    case FlightDataRecorderSchema::FIELD_TYPE_INT32:
+      return "int32";
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT32:
+      return "uint32";
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT64:
+      return "uint64";
+  }
+  return "unknown";
+}
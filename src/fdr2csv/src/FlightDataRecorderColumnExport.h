@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// Writes samples as a binary columnar file for analytics tools. The file contains one contiguous little-endian array
+// per field, the layout is described by a json sidecar written next to it (<file>.json):
+//
+//   {
+//     "format": "fdr-columns",
+//     "version": 1,
+//     "interface_version": 10,
+//     "byte_order": "little",
+//     "sample_count": 2050,
+//     "columns": [
+//       { "name": "ap_sm.time.dt", "type": "float64", "offset": 0, "count": 2050 },
+//       ...
+//     ]
+//   }
+//
+// Offsets are in bytes from the start of the file and aligned to eight bytes, so a column can be mapped and used
+// without parsing. Space is reserved for the announced number of samples; if the conversion stops early the sidecar
+// contains the number of samples actually written.
+class FlightDataRecorderColumnExport {
+ public:
+  bool open(const std::string& filePath,
+            const std::vector<FlightDataRecorderSchema::Field>& fields,
+            uint64_t numberOfSamples,
+            uint64_t interfaceVersion);
+
+  // appends the columns of a block of raw samples to the buffer, safe to call from several threads
+  static void transpose(std::string& buffer,
+                        const std::vector<FlightDataRecorderSchema::Field>& fields,
+                        size_t sampleSize,
+                        const unsigned char* samples,
+                        size_t numberOfSamples);
+
+  // writes a block transposed by transpose()
+  bool write(const std::string& buffer, size_t numberOfSamples);
+
+  // writes the sidecar
+  bool close();
+
+  const std::string& getError() const;
+
+  static const char* getTypeName(FlightDataRecorderSchema::FieldType type);
+
+ private:
+  std::string filePath;
+  std::ofstream out;
+  std::string error;
+  uint64_t interfaceVersion = 0;
+
+  std::vector<FlightDataRecorderSchema::Field> fields;
+  std::vector<uint64_t> columnOffsets;
+  uint64_t capacity = 0;
+  uint64_t sampleCount = 0;
+};
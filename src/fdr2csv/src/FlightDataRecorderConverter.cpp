@@ -1,987 +1,577 @@
 #include "FlightDataRecorderConverter.h"
 
+#include <charconv>
+#include <cstring>
+
 using namespace std;
 
-void FlightDataRecorderConverter::writeHeader(ofstream& out, const string& delimiter) {
-  out << "ap_sm.time.dt" << delimiter;
-  out << "ap_sm.time.simulation_time" << delimiter;
-  out << "ap_sm.data.aircraft_position.lat" << delimiter;
-  out << "ap_sm.data.aircraft_position.lon" << delimiter;
-  out << "ap_sm.data.aircraft_position.alt" << delimiter;
-  out << "ap_sm.data.Theta_deg" << delimiter;
-  out << "ap_sm.data.Phi_deg" << delimiter;
-  out << "ap_sm.data.qk_deg_s" << delimiter;
-  out << "ap_sm.data.rk_deg_s" << delimiter;
-  out << "ap_sm.data.pk_deg_s" << delimiter;
-  out << "ap_sm.data.V_ias_kn" << delimiter;
-  out << "ap_sm.data.V_tas_kn" << delimiter;
-  out << "ap_sm.data.V_mach" << delimiter;
-  out << "ap_sm.data.V_gnd_kn" << delimiter;
-  out << "ap_sm.data.alpha_deg" << delimiter;
-  out << "ap_sm.data.beta_deg" << delimiter;
-  out << "ap_sm.data.H_ft" << delimiter;
-  out << "ap_sm.data.H_ind_ft" << delimiter;
-  out << "ap_sm.data.H_radio_ft" << delimiter;
-  out << "ap_sm.data.H_dot_ft_min" << delimiter;
-  out << "ap_sm.data.Psi_magnetic_deg" << delimiter;
-  out << "ap_sm.data.Psi_magnetic_track_deg" << delimiter;
-  out << "ap_sm.data.Psi_true_deg" << delimiter;
-  out << "ap_sm.data.bx_m_s2" << delimiter;
-  out << "ap_sm.data.by_m_s2" << delimiter;
-  out << "ap_sm.data.bz_m_s2" << delimiter;
-  out << "ap_sm.data.nav_valid" << delimiter;
-  out << "ap_sm.data.nav_loc_deg" << delimiter;
-  out << "ap_sm.data.nav_dme_valid" << delimiter;
-  out << "ap_sm.data.nav_dme_nmi" << delimiter;
-  out << "ap_sm.data.nav_loc_valid" << delimiter;
-  out << "ap_sm.data.nav_loc_magvar_deg" << delimiter;
-  out << "ap_sm.data.nav_loc_error_deg" << delimiter;
-  out << "ap_sm.data.nav_loc_position.lat" << delimiter;
-  out << "ap_sm.data.nav_loc_position.lon" << delimiter;
-  out << "ap_sm.data.nav_loc_position.alt" << delimiter;
-  out << "ap_sm.data.nav_e_loc_valid" << delimiter;
-  out << "ap_sm.data.nav_e_loc_error_deg" << delimiter;
-  out << "ap_sm.data.nav_gs_valid" << delimiter;
-  out << "ap_sm.data.nav_gs_error_deg" << delimiter;
-  out << "ap_sm.data.nav_gs_position.lat" << delimiter;
-  out << "ap_sm.data.nav_gs_position.lon" << delimiter;
-  out << "ap_sm.data.nav_gs_position.alt" << delimiter;
-  out << "ap_sm.data.nav_e_gs_valid" << delimiter;
-  out << "ap_sm.data.nav_e_gs_error_deg" << delimiter;
-  out << "ap_sm.data.flight_guidance_xtk_nmi" << delimiter;
-  out << "ap_sm.data.flight_guidance_tae_deg" << delimiter;
-  out << "ap_sm.data.flight_phase" << delimiter;
-  out << "ap_sm.data.V2_kn" << delimiter;
-  out << "ap_sm.data.VAPP_kn" << delimiter;
-  out << "ap_sm.data.VLS_kn" << delimiter;
-  out << "ap_sm.data.is_flight_plan_available" << delimiter;
-  out << "ap_sm.data.altitude_constraint_ft" << delimiter;
-  out << "ap_sm.data.thrust_reduction_altitude" << delimiter;
-  out << "ap_sm.data.thrust_reduction_altitude_go_around" << delimiter;
-  out << "ap_sm.data.acceleration_altitude" << delimiter;
-  out << "ap_sm.data.acceleration_altitude_engine_out" << delimiter;
-  out << "ap_sm.data.acceleration_altitude_go_around" << delimiter;
-  out << "ap_sm.data.cruise_altitude" << delimiter;
-  out << "ap_sm.data.on_ground" << delimiter;
-  out << "ap_sm.data.zeta_deg" << delimiter;
-  out << "ap_sm.data.throttle_lever_1_pos" << delimiter;
-  out << "ap_sm.data.throttle_lever_2_pos" << delimiter;
-  out << "ap_sm.data.flaps_handle_index" << delimiter;
-  out << "ap_sm.data_computed.time_since_touchdown" << delimiter;
-  out << "ap_sm.data_computed.time_since_lift_off" << delimiter;
-  out << "ap_sm.data_computed.time_since_SRS" << delimiter;
-  out << "ap_sm.data_computed.H_fcu_in_selection" << delimiter;
-  out << "ap_sm.data_computed.H_constraint_valid" << delimiter;
-  out << "ap_sm.data_computed.Psi_fcu_in_selection" << delimiter;
-  out << "ap_sm.data_computed.gs_convergent_towards_beam" << delimiter;
-  out << "ap_sm.data_computed.H_dot_radio_fpm" << delimiter;
-  out << "ap_sm.data_computed.V_fcu_in_selection" << delimiter;
-  out << "ap_sm.input.FD_active" << delimiter;
-  out << "ap_sm.input.AP_1_push" << delimiter;
-  out << "ap_sm.input.AP_2_push" << delimiter;
-  out << "ap_sm.input.AP_DISCONNECT_push" << delimiter;
-  out << "ap_sm.input.HDG_push" << delimiter;
-  out << "ap_sm.input.HDG_pull" << delimiter;
-  out << "ap_sm.input.ALT_push" << delimiter;
-  out << "ap_sm.input.ALT_pull" << delimiter;
-  out << "ap_sm.input.VS_push" << delimiter;
-  out << "ap_sm.input.VS_pull" << delimiter;
-  out << "ap_sm.input.LOC_push" << delimiter;
-  out << "ap_sm.input.APPR_push" << delimiter;
-  out << "ap_sm.input.EXPED_push" << delimiter;
-  out << "ap_sm.input.V_c_kn" << delimiter;
-  out << "ap_sm.input.Psi_fcu_deg" << delimiter;
-  out << "ap_sm.input.H_fcu_ft" << delimiter;
-  out << "ap_sm.input.H_constraint_ft" << delimiter;
-  out << "ap_sm.input.H_dot_fcu_fpm" << delimiter;
-  out << "ap_sm.input.FPA_fcu_deg" << delimiter;
-  out << "ap_sm.input.TRK_FPA_mode" << delimiter;
-  out << "ap_sm.input.DIR_TO_trigger" << delimiter;
-  out << "ap_sm.input.is_FLX_active" << delimiter;
-  out << "ap_sm.input.Slew_trigger" << delimiter;
-  out << "ap_sm.input.MACH_mode" << delimiter;
-  out << "ap_sm.input.ATHR_engaged" << delimiter;
-  out << "ap_sm.input.is_SPEED_managed" << delimiter;
-  out << "ap_sm.input.FDR_event" << delimiter;
-  out << "ap_sm.lateral.armed.NAV" << delimiter;
-  out << "ap_sm.lateral.armed.LOC" << delimiter;
-  out << "ap_sm.lateral.condition.NAV" << delimiter;
-  out << "ap_sm.lateral.condition.LOC_CPT" << delimiter;
-  out << "ap_sm.lateral.condition.LOC_TRACK" << delimiter;
-  out << "ap_sm.lateral.condition.LAND" << delimiter;
-  out << "ap_sm.lateral.condition.FLARE" << delimiter;
-  out << "ap_sm.lateral.condition.ROLL_OUT" << delimiter;
-  out << "ap_sm.lateral.condition.GA_TRACK" << delimiter;
-  out << "ap_sm.lateral.output.mode" << delimiter;
-  out << "ap_sm.lateral.output.mode_reversion" << delimiter;
-  out << "ap_sm.lateral.output.mode_reversion_TRK_FPA" << delimiter;
-  out << "ap_sm.lateral.output.law" << delimiter;
-  out << "ap_sm.lateral.output.Psi_c_deg" << delimiter;
-  out << "ap_sm.lateral_previous.armed.NAV" << delimiter;
-  out << "ap_sm.lateral_previous.armed.LOC" << delimiter;
-  out << "ap_sm.lateral_previous.condition.NAV" << delimiter;
-  out << "ap_sm.lateral_previous.condition.LOC_CPT" << delimiter;
-  out << "ap_sm.lateral_previous.condition.LOC_TRACK" << delimiter;
-  out << "ap_sm.lateral_previous.condition.LAND" << delimiter;
-  out << "ap_sm.lateral_previous.condition.FLARE" << delimiter;
-  out << "ap_sm.lateral_previous.condition.ROLL_OUT" << delimiter;
-  out << "ap_sm.lateral_previous.condition.GA_TRACK" << delimiter;
-  out << "ap_sm.lateral_previous.output.mode" << delimiter;
-  out << "ap_sm.lateral_previous.output.mode_reversion" << delimiter;
-  out << "ap_sm.lateral_previous.output.mode_reversion_TRK_FPA" << delimiter;
-  out << "ap_sm.lateral_previous.output.law" << delimiter;
-  out << "ap_sm.lateral_previous.output.Psi_c_deg" << delimiter;
-  out << "ap_sm.vertical.armed.ALT" << delimiter;
-  out << "ap_sm.vertical.armed.ALT_CST" << delimiter;
-  out << "ap_sm.vertical.armed.CLB" << delimiter;
-  out << "ap_sm.vertical.armed.DES" << delimiter;
-  out << "ap_sm.vertical.armed.GS" << delimiter;
-  out << "ap_sm.vertical.condition.ALT" << delimiter;
-  out << "ap_sm.vertical.condition.ALT_CPT" << delimiter;
-  out << "ap_sm.vertical.condition.ALT_CST" << delimiter;
-  out << "ap_sm.vertical.condition.ALT_CST_CPT" << delimiter;
-  out << "ap_sm.vertical.condition.CLB" << delimiter;
-  out << "ap_sm.vertical.condition.DES" << delimiter;
-  out << "ap_sm.vertical.condition.GS_CPT" << delimiter;
-  out << "ap_sm.vertical.condition.GS_TRACK" << delimiter;
-  out << "ap_sm.vertical.condition.LAND" << delimiter;
-  out << "ap_sm.vertical.condition.FLARE" << delimiter;
-  out << "ap_sm.vertical.condition.ROLL_OUT" << delimiter;
-  out << "ap_sm.vertical.condition.SRS" << delimiter;
-  out << "ap_sm.vertical.condition.SRS_GA" << delimiter;
-  out << "ap_sm.vertical.condition.THR_RED" << delimiter;
-  out << "ap_sm.vertical.condition.H_fcu_active" << delimiter;
-  out << "ap_sm.vertical.output.mode" << delimiter;
-  out << "ap_sm.vertical.output.mode_autothrust" << delimiter;
-  out << "ap_sm.vertical.output.mode_reversion" << delimiter;
-  out << "ap_sm.vertical.output.law" << delimiter;
-  out << "ap_sm.vertical.output.H_c_ft" << delimiter;
-  out << "ap_sm.vertical.output.H_dot_c_fpm" << delimiter;
-  out << "ap_sm.vertical.output.FPA_c_deg" << delimiter;
-  out << "ap_sm.vertical.output.V_c_kn" << delimiter;
-  out << "ap_sm.vertical.output.ALT_soft_mode_active" << delimiter;
-  out << "ap_sm.vertical.output.EXPED_mode_active" << delimiter;
-  out << "ap_sm.vertical.output.FD_disconnect" << delimiter;
-  out << "ap_sm.vertical_previous.armed.ALT" << delimiter;
-  out << "ap_sm.vertical_previous.armed.ALT_CST" << delimiter;
-  out << "ap_sm.vertical_previous.armed.CLB" << delimiter;
-  out << "ap_sm.vertical_previous.armed.DES" << delimiter;
-  out << "ap_sm.vertical_previous.armed.GS" << delimiter;
-  out << "ap_sm.vertical_previous.condition.ALT" << delimiter;
-  out << "ap_sm.vertical_previous.condition.ALT_CPT" << delimiter;
-  out << "ap_sm.vertical_previous.condition.ALT_CST" << delimiter;
-  out << "ap_sm.vertical_previous.condition.ALT_CST_CPT" << delimiter;
-  out << "ap_sm.vertical_previous.condition.CLB" << delimiter;
-  out << "ap_sm.vertical_previous.condition.DES" << delimiter;
-  out << "ap_sm.vertical_previous.condition.GS_CPT" << delimiter;
-  out << "ap_sm.vertical_previous.condition.GS_TRACK" << delimiter;
-  out << "ap_sm.vertical_previous.condition.LAND" << delimiter;
-  out << "ap_sm.vertical_previous.condition.FLARE" << delimiter;
-  out << "ap_sm.vertical_previous.condition.ROLL_OUT" << delimiter;
-  out << "ap_sm.vertical_previous.condition.SRS" << delimiter;
-  out << "ap_sm.vertical_previous.condition.SRS_GA" << delimiter;
-  out << "ap_sm.vertical_previous.condition.THR_RED" << delimiter;
-  out << "ap_sm.vertical_previous.condition.H_fcu_active" << delimiter;
-  out << "ap_sm.vertical_previous.output.mode" << delimiter;
-  out << "ap_sm.vertical_previous.output.mode_autothrust" << delimiter;
-  out << "ap_sm.vertical_previous.output.mode_reversion" << delimiter;
-  out << "ap_sm.vertical_previous.output.law" << delimiter;
-  out << "ap_sm.vertical_previous.output.H_c_ft" << delimiter;
-  out << "ap_sm.vertical_previous.output.H_dot_c_fpm" << delimiter;
-  out << "ap_sm.vertical_previous.output.FPA_c_deg" << delimiter;
-  out << "ap_sm.vertical_previous.output.V_c_kn" << delimiter;
-  out << "ap_sm.vertical_previous.output.ALT_soft_mode_active" << delimiter;
-  out << "ap_sm.vertical_previous.output.EXPED_mode_active" << delimiter;
-  out << "ap_sm.vertical_previous.output.FD_disconnect" << delimiter;
-  out << "ap_sm.output.enabled_AP1" << delimiter;
-  out << "ap_sm.output.enabled_AP2" << delimiter;
-  out << "ap_sm.output.lateral_law" << delimiter;
-  out << "ap_sm.output.lateral_mode" << delimiter;
-  out << "ap_sm.output.lateral_mode_armed" << delimiter;
-  out << "ap_sm.output.vertical_law" << delimiter;
-  out << "ap_sm.output.vertical_mode" << delimiter;
-  out << "ap_sm.output.vertical_mode_armed" << delimiter;
-  out << "ap_sm.output.mode_reversion_lateral" << delimiter;
-  out << "ap_sm.output.mode_reversion_vertical" << delimiter;
-  out << "ap_sm.output.mode_reversion_TRK_FPA" << delimiter;
-  out << "ap_sm.output.mode_reversion_triple_click" << delimiter;
-  out << "ap_sm.output.mode_reversion_fma" << delimiter;
-  out << "ap_sm.output.speed_protection_mode" << delimiter;
-  out << "ap_sm.output.autothrust_mode" << delimiter;
-  out << "ap_sm.output.Psi_c_deg" << delimiter;
-  out << "ap_sm.output.H_c_ft" << delimiter;
-  out << "ap_sm.output.H_dot_c_fpm" << delimiter;
-  out << "ap_sm.output.FPA_c_deg" << delimiter;
-  out << "ap_sm.output.V_c_kn" << delimiter;
-  out << "ap_sm.output.ALT_soft_mode_active" << delimiter;
-  out << "ap_sm.output.EXPED_mode_active" << delimiter;
-  out << "ap_sm.output.FD_disconnect" << delimiter;
-  out << "ap_law.ap_on" << delimiter;
-  out << "ap_law.flight_director.Theta_c_deg" << delimiter;
-  out << "ap_law.flight_director.Phi_c_deg" << delimiter;
-  out << "ap_law.flight_director.Beta_c_deg" << delimiter;
-  out << "ap_law.autopilot.Theta_c_deg" << delimiter;
-  out << "ap_law.autopilot.Phi_c_deg" << delimiter;
-  out << "ap_law.autopilot.Beta_c_deg" << delimiter;
-  out << "athr.data.nz_g" << delimiter;
-  out << "athr.data.Theta_deg" << delimiter;
-  out << "athr.data.Phi_deg" << delimiter;
-  out << "athr.data.V_ias_kn" << delimiter;
-  out << "athr.data.V_tas_kn" << delimiter;
-  out << "athr.data.V_mach" << delimiter;
-  out << "athr.data.V_gnd_kn" << delimiter;
-  out << "athr.data.alpha_deg" << delimiter;
-  out << "athr.data.H_ft" << delimiter;
-  out << "athr.data.H_ind_ft" << delimiter;
-  out << "athr.data.H_radio_ft" << delimiter;
-  out << "athr.data.H_dot_fpm" << delimiter;
-  out << "athr.data.ax_m_s2" << delimiter;
-  out << "athr.data.ay_m_s2" << delimiter;
-  out << "athr.data.az_m_s2" << delimiter;
-  out << "athr.data.bx_m_s2" << delimiter;
-  out << "athr.data.by_m_s2" << delimiter;
-  out << "athr.data.bz_m_s2" << delimiter;
-  out << "athr.data.on_ground" << delimiter;
-  out << "athr.data.flap_handle_index" << delimiter;
-  out << "athr.data.is_engine_operative_1" << delimiter;
-  out << "athr.data.is_engine_operative_2" << delimiter;
-  out << "athr.data.commanded_engine_N1_1_percent" << delimiter;
-  out << "athr.data.commanded_engine_N1_2_percent" << delimiter;
-  out << "athr.data.engine_N1_1_percent" << delimiter;
-  out << "athr.data.engine_N1_2_percent" << delimiter;
-  out << "athr.data.TAT_degC" << delimiter;
-  out << "athr.data.OAT_degC" << delimiter;
-  out << "athr.data.ISA_degC" << delimiter;
-  out << "athr.data_computed.TLA_in_active_range" << delimiter;
-  out << "athr.data_computed.is_FLX_active" << delimiter;
-  out << "athr.data_computed.ATHR_push" << delimiter;
-  out << "athr.data_computed.ATHR_disabled" << delimiter;
-  out << "athr.data_computed.time_since_touchdown" << delimiter;
-  out << "athr.input.ATHR_push" << delimiter;
-  out << "athr.input.ATHR_disconnect" << delimiter;
-  out << "athr.input.TLA_1_deg" << delimiter;
-  out << "athr.input.TLA_2_deg" << delimiter;
-  out << "athr.input.V_c_kn" << delimiter;
-  out << "athr.input.V_LS_kn" << delimiter;
-  out << "athr.input.V_MAX_kn" << delimiter;
-  out << "athr.input.thrust_limit_REV_percent" << delimiter;
-  out << "athr.input.thrust_limit_IDLE_percent" << delimiter;
-  out << "athr.input.thrust_limit_CLB_percent" << delimiter;
-  out << "athr.input.thrust_limit_MCT_percent" << delimiter;
-  out << "athr.input.thrust_limit_FLEX_percent" << delimiter;
-  out << "athr.input.thrust_limit_TOGA_percent" << delimiter;
-  out << "athr.input.flex_temperature_degC" << delimiter;
-  out << "athr.input.mode_requested" << delimiter;
-  out << "athr.input.is_mach_mode_active" << delimiter;
-  out << "athr.input.alpha_floor_condition" << delimiter;
-  out << "athr.input.is_approach_mode_active" << delimiter;
-  out << "athr.input.is_SRS_TO_mode_active" << delimiter;
-  out << "athr.input.is_SRS_GA_mode_active" << delimiter;
-  out << "athr.input.thrust_reduction_altitude" << delimiter;
-  out << "athr.input.thrust_reduction_altitude_go_around" << delimiter;
-  out << "athr.input.is_anti_ice_wing_active" << delimiter;
-  out << "athr.input.is_anti_ice_engine_1_active" << delimiter;
-  out << "athr.input.is_anti_ice_engine_2_active" << delimiter;
-  out << "athr.input.is_air_conditioning_1_active" << delimiter;
-  out << "athr.input.is_air_conditioning_2_active" << delimiter;
-  out << "athr.input.FD_active" << delimiter;
-  out << "athr.input.ATHR_reset_disable" << delimiter;
-  out << "athr.output.sim_throttle_lever_1_pos" << delimiter;
-  out << "athr.output.sim_throttle_lever_2_pos" << delimiter;
-  out << "athr.output.sim_thrust_mode_1" << delimiter;
-  out << "athr.output.sim_thrust_mode_2" << delimiter;
-  out << "athr.output.N1_TLA_1_percent" << delimiter;
-  out << "athr.output.N1_TLA_2_percent" << delimiter;
-  out << "athr.output.is_in_reverse_1" << delimiter;
-  out << "athr.output.is_in_reverse_2" << delimiter;
-  out << "athr.output.thrust_limit_type" << delimiter;
-  out << "athr.output.thrust_limit_percent" << delimiter;
-  out << "athr.output.N1_c_1_percent" << delimiter;
-  out << "athr.output.N1_c_2_percent" << delimiter;
-  out << "athr.output.status" << delimiter;
-  out << "athr.output.mode" << delimiter;
-  out << "athr.output.mode_message" << delimiter;
-  out << "athr.output.thrust_lever_warning_flex" << delimiter;
-  out << "athr.output.thrust_lever_warning_toga" << delimiter;
-  out << "fbw.sim.time.monotonic_time" << delimiter;
-  out << "fbw.sim.time.dt" << delimiter;
-  out << "fbw.sim.time.simulation_time" << delimiter;
-  out << "fbw.sim.time.monotonic_time" << delimiter;
-  out << "fbw.sim.data.nz_g" << delimiter;
-  out << "fbw.sim.data.Theta_deg" << delimiter;
-  out << "fbw.sim.data.Phi_deg" << delimiter;
-  out << "fbw.sim.data.q_deg_s" << delimiter;
-  out << "fbw.sim.data.r_deg_s" << delimiter;
-  out << "fbw.sim.data.p_deg_s" << delimiter;
-  out << "fbw.sim.data.qk_deg_s" << delimiter;
-  out << "fbw.sim.data.rk_deg_s" << delimiter;
-  out << "fbw.sim.data.pk_deg_s" << delimiter;
-  out << "fbw.sim.data.qk_dot_deg_s2" << delimiter;
-  out << "fbw.sim.data.rk_dot_deg_s2" << delimiter;
-  out << "fbw.sim.data.pk_dot_deg_s2" << delimiter;
-  out << "fbw.sim.data.psi_magnetic_deg" << delimiter;
-  out << "fbw.sim.data.psi_true_deg" << delimiter;
-  out << "fbw.sim.data.eta_deg" << delimiter;
-  out << "fbw.sim.data.eta_trim_deg" << delimiter;
-  out << "fbw.sim.data.xi_deg" << delimiter;
-  out << "fbw.sim.data.zeta_deg" << delimiter;
-  out << "fbw.sim.data.zeta_trim_deg" << delimiter;
-  out << "fbw.sim.data.alpha_deg" << delimiter;
-  out << "fbw.sim.data.beta_deg" << delimiter;
-  out << "fbw.sim.data.beta_dot_deg_s" << delimiter;
-  out << "fbw.sim.data.V_ias_kn" << delimiter;
-  out << "fbw.sim.data.V_tas_kn" << delimiter;
-  out << "fbw.sim.data.V_mach" << delimiter;
-  out << "fbw.sim.data.H_ft" << delimiter;
-  out << "fbw.sim.data.H_ind_ft" << delimiter;
-  out << "fbw.sim.data.H_radio_ft" << delimiter;
-  out << "fbw.sim.data.CG_percent_MAC" << delimiter;
-  out << "fbw.sim.data.total_weight_kg" << delimiter;
-  out << "fbw.sim.data.gear_strut_compression_0" << delimiter;
-  out << "fbw.sim.data.gear_strut_compression_1" << delimiter;
-  out << "fbw.sim.data.gear_strut_compression_2" << delimiter;
-  out << "fbw.sim.data.flaps_handle_index" << delimiter;
-  out << "fbw.sim.data.spoilers_left_pos" << delimiter;
-  out << "fbw.sim.data.spoilers_right_pos" << delimiter;
-  out << "fbw.sim.data.autopilot_master_on" << delimiter;
-  out << "fbw.sim.data.slew_on" << delimiter;
-  out << "fbw.sim.data.pause_on" << delimiter;
-  out << "fbw.sim.data.tracking_mode_on_override" << delimiter;
-  out << "fbw.sim.data.autopilot_custom_on" << delimiter;
-  out << "fbw.sim.data.autopilot_custom_Theta_c_deg" << delimiter;
-  out << "fbw.sim.data.autopilot_custom_Phi_c_deg" << delimiter;
-  out << "fbw.sim.data.autopilot_custom_Beta_c_deg" << delimiter;
-  out << "fbw.sim.data.simulation_rate" << delimiter;
-  out << "fbw.sim.data.ice_structure_percent" << delimiter;
-  out << "fbw.sim.data.linear_cl_alpha_per_deg" << delimiter;
-  out << "fbw.sim.data.alpha_stall_deg" << delimiter;
-  out << "fbw.sim.data.alpha_zero_lift_deg" << delimiter;
-  out << "fbw.sim.data.ambient_density_kg_per_m3" << delimiter;
-  out << "fbw.sim.data.ambient_pressure_mbar" << delimiter;
-  out << "fbw.sim.data.ambient_temperature_celsius" << delimiter;
-  out << "fbw.sim.data.ambient_wind_x_kn" << delimiter;
-  out << "fbw.sim.data.ambient_wind_y_kn" << delimiter;
-  out << "fbw.sim.data.ambient_wind_z_kn" << delimiter;
-  out << "fbw.sim.data.ambient_wind_velocity_kn" << delimiter;
-  out << "fbw.sim.data.ambient_wind_direction_deg" << delimiter;
-  out << "fbw.sim.data.total_air_temperature_celsius" << delimiter;
-  out << "fbw.sim.data.latitude_deg" << delimiter;
-  out << "fbw.sim.data.longitude_deg" << delimiter;
-  out << "fbw.sim.data.engine_1_thrust_lbf" << delimiter;
-  out << "fbw.sim.data.engine_2_thrust_lbf" << delimiter;
-  out << "fbw.sim.data.thrust_lever_1_pos" << delimiter;
-  out << "fbw.sim.data.thrust_lever_2_pos" << delimiter;
-  out << "fbw.sim.data_computed.on_ground" << delimiter;
-  out << "fbw.sim.data_computed.tracking_mode_on" << delimiter;
-  out << "fbw.sim.data_computed.high_aoa_prot_active" << delimiter;
-  out << "fbw.sim.data_computed.alpha_floor_command" << delimiter;
-  out << "fbw.sim.data_computed.protection_ap_disc" << delimiter;
-  out << "fbw.sim.data_computed.high_speed_prot_active" << delimiter;
-  out << "fbw.sim.data_computed.high_speed_prot_low_kn" << delimiter;
-  out << "fbw.sim.data_computed.high_speed_prot_high_kn" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.v_alpha_max_kn" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.alpha_max_deg" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.v_alpha_prot_kn" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.alpha_prot_deg" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.alpha_floor_deg" << delimiter;
-  out << "fbw.sim.data_speeds_aoa.alpha_filtered_deg" << delimiter;
-  out << "fbw.sim.input.delta_eta_pos" << delimiter;
-  out << "fbw.sim.input.delta_xi_pos" << delimiter;
-  out << "fbw.sim.input.delta_zeta_pos" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_limit_lo" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_limit_up" << delimiter;
-  out << "fbw.pitch.data_computed.delta_eta_deg" << delimiter;
-  out << "fbw.pitch.data_computed.in_flight" << delimiter;
-  out << "fbw.pitch.data_computed.in_rotation" << delimiter;
-  out << "fbw.pitch.data_computed.in_flare" << delimiter;
-  out << "fbw.pitch.data_computed.in_flight_gain" << delimiter;
-  out << "fbw.pitch.data_computed.in_rotation_gain" << delimiter;
-  out << "fbw.pitch.data_computed.nz_limit_up_g" << delimiter;
-  out << "fbw.pitch.data_computed.nz_limit_lo_g" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_should_freeze" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_reset" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_reset_deg" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_should_write" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s" << delimiter;
-  out << "fbw.pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s" << delimiter;
-  out << "fbw.pitch.data_computed.flare_Theta_deg" << delimiter;
-  out << "fbw.pitch.data_computed.flare_Theta_c_deg" << delimiter;
-  out << "fbw.pitch.data_computed.flare_Theta_c_rate_deg_s" << delimiter;
-  out << "fbw.pitch.law_rotation.qk_c_deg_s" << delimiter;
-  out << "fbw.pitch.law_rotation.eta_deg" << delimiter;
-  out << "fbw.pitch.law_normal.nz_c_g" << delimiter;
-  out << "fbw.pitch.law_normal.Cstar_g" << delimiter;
-  out << "fbw.pitch.law_normal.protection_alpha_c_deg" << delimiter;
-  out << "fbw.pitch.law_normal.protection_V_c_kn" << delimiter;
-  out << "fbw.pitch.law_normal.eta_dot_deg_s" << delimiter;
-  out << "fbw.pitch.vote.eta_dot_deg_s" << delimiter;
-  out << "fbw.pitch.integrated.eta_deg" << delimiter;
-  out << "fbw.pitch.output.eta_deg" << delimiter;
-  out << "fbw.pitch.output.eta_trim_deg" << delimiter;
-  out << "fbw.roll.data_computed.delta_xi_deg" << delimiter;
-  out << "fbw.roll.data_computed.delta_zeta_deg" << delimiter;
-  out << "fbw.roll.data_computed.in_flight" << delimiter;
-  out << "fbw.roll.data_computed.in_flight_gain" << delimiter;
-  out << "fbw.roll.data_computed.zeta_trim_deg_should_write" << delimiter;
-  out << "fbw.roll.data_computed.beta_target_deg" << delimiter;
-  out << "fbw.roll.law_normal.pk_c_deg_s" << delimiter;
-  out << "fbw.roll.law_normal.Phi_c_deg" << delimiter;
-  out << "fbw.roll.law_normal.xi_deg" << delimiter;
-  out << "fbw.roll.law_normal.zeta_deg" << delimiter;
-  out << "fbw.roll.law_normal.zeta_tc_yd_deg" << delimiter;
-  out << "fbw.roll.output.xi_deg" << delimiter;
-  out << "fbw.roll.output.zeta_deg" << delimiter;
-  out << "fbw.roll.output.zeta_trim_deg" << delimiter;
-  out << "fbw.output.eta_pos" << delimiter;
-  out << "fbw.output.eta_trim_deg" << delimiter;
-  out << "fbw.output.eta_trim_deg_should_write" << delimiter;
-  out << "fbw.output.xi_pos" << delimiter;
-  out << "fbw.output.zeta_pos" << delimiter;
-  out << "fbw.output.zeta_trim_pos" << delimiter;
-  out << "fbw.output.zeta_trim_pos_should_write" << delimiter;
-  out << "engine.simOnGround" << delimiter;
-  out << "engine.generalEngineElapsedTime_1" << delimiter;
-  out << "engine.generalEngineElapsedTime_2" << delimiter;
-  out << "engine.standardAtmTemperature" << delimiter;
-  out << "engine.turbineEngineCorrectedFuelFlow_1" << delimiter;
-  out << "engine.turbineEngineCorrectedFuelFlow_2" << delimiter;
-  out << "engine.fuelTankCapacityAuxLeft" << delimiter;
-  out << "engine.fuelTankCapacityAuxRight" << delimiter;
-  out << "engine.fuelTankCapacityMainLeft" << delimiter;
-  out << "engine.fuelTankCapacityMainRight" << delimiter;
-  out << "engine.fuelTankCapacityCenter" << delimiter;
-  out << "engine.fuelTankQuantityAuxLeft" << delimiter;
-  out << "engine.fuelTankQuantityAuxRight" << delimiter;
-  out << "engine.fuelTankQuantityMainLeft" << delimiter;
-  out << "engine.fuelTankQuantityMainRight" << delimiter;
-  out << "engine.fuelTankQuantityCenter" << delimiter;
-  out << "engine.fuelTankQuantityTotal" << delimiter;
-  out << "engine.fuelWeightPerGallon" << delimiter;
-  out << "engine.engineEngine1N2" << delimiter;
-  out << "engine.engineEngine2N2" << delimiter;
-  out << "engine.engineEngine1N1" << delimiter;
-  out << "engine.engineEngine2N1" << delimiter;
-  out << "engine.engineEngineIdleN1" << delimiter;
-  out << "engine.engineEngineIdleN2" << delimiter;
-  out << "engine.engineEngineIdleFF" << delimiter;
-  out << "engine.engineEngineIdleEGT" << delimiter;
-  out << "engine.engineEngine1EGT" << delimiter;
-  out << "engine.engineEngine2EGT" << delimiter;
-  out << "engine.engineEngine1Oil" << delimiter;
-  out << "engine.engineEngine2Oil" << delimiter;
-  out << "engine.engineEngine1TotalOil" << delimiter;
-  out << "engine.engineEngine2TotalOil" << delimiter;
-  out << "engine.engineEngine1FF" << delimiter;
-  out << "engine.engineEngine2FF" << delimiter;
-  out << "engine.engineEngine1PreFF" << delimiter;
-  out << "engine.engineEngine2PreFF" << delimiter;
-  out << "engine.engineEngineImbalance" << delimiter;
-  out << "engine.engineFuelUsedLeft" << delimiter;
-  out << "engine.engineFuelUsedRight" << delimiter;
-  out << "engine.engineFuelLeftPre" << delimiter;
-  out << "engine.engineFuelRightPre" << delimiter;
-  out << "engine.engineFuelAuxLeftPre" << delimiter;
-  out << "engine.engineFuelAuxRightPre" << delimiter;
-  out << "engine.engineFuelCenterPre" << delimiter;
-  out << "engine.engineEngineCycleTime" << delimiter;
-  out << "engine.engineEngine1State" << delimiter;
-  out << "engine.engineEngine2State" << delimiter;
-  out << "engine.engineEngine1Timer" << delimiter;
-  out << "engine.engineEngine2Timer" << delimiter;
-  out << endl;
+#define COLUMN(path) makeColumn<decltype(std::declval<FlightDataRecorderSample&>().path)>(#path, offsetof(FlightDataRecorderSample, path))
+#define NAMED_COLUMN(name, path) \
+  makeColumn<decltype(std::declval<FlightDataRecorderSample&>().path)>(name, offsetof(FlightDataRecorderSample, path))
+#define UNSIGNED_COLUMN(path)                                                                                               \
+  makeColumn<decltype(std::declval<FlightDataRecorderSample&>().path)>(#path, offsetof(FlightDataRecorderSample, path), \
+                                                                       COLUMN_FORMAT_UNSIGNED)
+
+template <typename T>
+static FlightDataRecorderConverter::Column makeColumn(const char* name,
+                                                      size_t offset,
+                                                      FlightDataRecorderConverter::ColumnFormat format = FlightDataRecorderConverter::COLUMN_FORMAT_NATIVE) {
+  auto field = FlightDataRecorderSchema::makeField<T>(name, offset);
+  return {field.path, field.type, field.offset, format};
+}
+
+const vector<FlightDataRecorderConverter::Column>& FlightDataRecorderConverter::getLegacyColumns() {
+  // historic layout of the csv files, a subset of the sample in its own order which must not change
+  static const vector<Column> columns = {
+      COLUMN(ap_sm.time.dt),
+      COLUMN(ap_sm.time.simulation_time),
+      COLUMN(ap_sm.data.aircraft_position.lat),
+      COLUMN(ap_sm.data.aircraft_position.lon),
+      COLUMN(ap_sm.data.aircraft_position.alt),
+      COLUMN(ap_sm.data.Theta_deg),
+      COLUMN(ap_sm.data.Phi_deg),
+      COLUMN(ap_sm.data.qk_deg_s),
+      COLUMN(ap_sm.data.rk_deg_s),
+      COLUMN(ap_sm.data.pk_deg_s),
+      COLUMN(ap_sm.data.V_ias_kn),
+      COLUMN(ap_sm.data.V_tas_kn),
+      COLUMN(ap_sm.data.V_mach),
+      COLUMN(ap_sm.data.V_gnd_kn),
+      COLUMN(ap_sm.data.alpha_deg),
+      COLUMN(ap_sm.data.beta_deg),
+      COLUMN(ap_sm.data.H_ft),
+      COLUMN(ap_sm.data.H_ind_ft),
+      COLUMN(ap_sm.data.H_radio_ft),
+      COLUMN(ap_sm.data.H_dot_ft_min),
+      COLUMN(ap_sm.data.Psi_magnetic_deg),
+      COLUMN(ap_sm.data.Psi_magnetic_track_deg),
+      COLUMN(ap_sm.data.Psi_true_deg),
+      COLUMN(ap_sm.data.bx_m_s2),
+      COLUMN(ap_sm.data.by_m_s2),
+      COLUMN(ap_sm.data.bz_m_s2),
+      COLUMN(ap_sm.data.nav_valid),
+      COLUMN(ap_sm.data.nav_loc_deg),
+      // written as flag like the other nav valid fields
+      UNSIGNED_COLUMN(ap_sm.data.nav_dme_valid),
+      COLUMN(ap_sm.data.nav_dme_nmi),
+      COLUMN(ap_sm.data.nav_loc_valid),
+      COLUMN(ap_sm.data.nav_loc_magvar_deg),
+      COLUMN(ap_sm.data.nav_loc_error_deg),
+      COLUMN(ap_sm.data.nav_loc_position.lat),
+      COLUMN(ap_sm.data.nav_loc_position.lon),
+      COLUMN(ap_sm.data.nav_loc_position.alt),
+      COLUMN(ap_sm.data.nav_e_loc_valid),
+      COLUMN(ap_sm.data.nav_e_loc_error_deg),
+      COLUMN(ap_sm.data.nav_gs_valid),
+      COLUMN(ap_sm.data.nav_gs_error_deg),
+      COLUMN(ap_sm.data.nav_gs_position.lat),
+      COLUMN(ap_sm.data.nav_gs_position.lon),
+      COLUMN(ap_sm.data.nav_gs_position.alt),
+      COLUMN(ap_sm.data.nav_e_gs_valid),
+      COLUMN(ap_sm.data.nav_e_gs_error_deg),
+      COLUMN(ap_sm.data.flight_guidance_xtk_nmi),
+      COLUMN(ap_sm.data.flight_guidance_tae_deg),
+      COLUMN(ap_sm.data.flight_phase),
+      COLUMN(ap_sm.data.V2_kn),
+      COLUMN(ap_sm.data.VAPP_kn),
+      COLUMN(ap_sm.data.VLS_kn),
+      COLUMN(ap_sm.data.is_flight_plan_available),
+      COLUMN(ap_sm.data.altitude_constraint_ft),
+      COLUMN(ap_sm.data.thrust_reduction_altitude),
+      COLUMN(ap_sm.data.thrust_reduction_altitude_go_around),
+      COLUMN(ap_sm.data.acceleration_altitude),
+      COLUMN(ap_sm.data.acceleration_altitude_engine_out),
+      COLUMN(ap_sm.data.acceleration_altitude_go_around),
+      COLUMN(ap_sm.data.cruise_altitude),
+      COLUMN(ap_sm.data.on_ground),
+      COLUMN(ap_sm.data.zeta_deg),
+      COLUMN(ap_sm.data.throttle_lever_1_pos),
+      COLUMN(ap_sm.data.throttle_lever_2_pos),
+      COLUMN(ap_sm.data.flaps_handle_index),
+      COLUMN(ap_sm.data_computed.time_since_touchdown),
+      COLUMN(ap_sm.data_computed.time_since_lift_off),
+      COLUMN(ap_sm.data_computed.time_since_SRS),
+      COLUMN(ap_sm.data_computed.H_fcu_in_selection),
+      COLUMN(ap_sm.data_computed.H_constraint_valid),
+      COLUMN(ap_sm.data_computed.Psi_fcu_in_selection),
+      COLUMN(ap_sm.data_computed.gs_convergent_towards_beam),
+      COLUMN(ap_sm.data_computed.H_dot_radio_fpm),
+      COLUMN(ap_sm.data_computed.V_fcu_in_selection),
+      COLUMN(ap_sm.input.FD_active),
+      COLUMN(ap_sm.input.AP_1_push),
+      COLUMN(ap_sm.input.AP_2_push),
+      COLUMN(ap_sm.input.AP_DISCONNECT_push),
+      COLUMN(ap_sm.input.HDG_push),
+      COLUMN(ap_sm.input.HDG_pull),
+      COLUMN(ap_sm.input.ALT_push),
+      COLUMN(ap_sm.input.ALT_pull),
+      COLUMN(ap_sm.input.VS_push),
+      COLUMN(ap_sm.input.VS_pull),
+      COLUMN(ap_sm.input.LOC_push),
+      COLUMN(ap_sm.input.APPR_push),
+      COLUMN(ap_sm.input.EXPED_push),
+      // keeps the column name of older versions
+      NAMED_COLUMN("ap_sm.input.V_c_kn", ap_sm.input.V_fcu_kn),
+      COLUMN(ap_sm.input.Psi_fcu_deg),
+      COLUMN(ap_sm.input.H_fcu_ft),
+      COLUMN(ap_sm.input.H_constraint_ft),
+      COLUMN(ap_sm.input.H_dot_fcu_fpm),
+      COLUMN(ap_sm.input.FPA_fcu_deg),
+      COLUMN(ap_sm.input.TRK_FPA_mode),
+      COLUMN(ap_sm.input.DIR_TO_trigger),
+      COLUMN(ap_sm.input.is_FLX_active),
+      COLUMN(ap_sm.input.Slew_trigger),
+      COLUMN(ap_sm.input.MACH_mode),
+      COLUMN(ap_sm.input.ATHR_engaged),
+      COLUMN(ap_sm.input.is_SPEED_managed),
+      COLUMN(ap_sm.input.FDR_event),
+      COLUMN(ap_sm.lateral.armed.NAV),
+      COLUMN(ap_sm.lateral.armed.LOC),
+      COLUMN(ap_sm.lateral.condition.NAV),
+      COLUMN(ap_sm.lateral.condition.LOC_CPT),
+      COLUMN(ap_sm.lateral.condition.LOC_TRACK),
+      COLUMN(ap_sm.lateral.condition.LAND),
+      COLUMN(ap_sm.lateral.condition.FLARE),
+      COLUMN(ap_sm.lateral.condition.ROLL_OUT),
+      COLUMN(ap_sm.lateral.condition.GA_TRACK),
+      COLUMN(ap_sm.lateral.output.mode),
+      COLUMN(ap_sm.lateral.output.mode_reversion),
+      COLUMN(ap_sm.lateral.output.mode_reversion_TRK_FPA),
+      COLUMN(ap_sm.lateral.output.law),
+      COLUMN(ap_sm.lateral.output.Psi_c_deg),
+      COLUMN(ap_sm.lateral_previous.armed.NAV),
+      COLUMN(ap_sm.lateral_previous.armed.LOC),
+      COLUMN(ap_sm.lateral_previous.condition.NAV),
+      COLUMN(ap_sm.lateral_previous.condition.LOC_CPT),
+      COLUMN(ap_sm.lateral_previous.condition.LOC_TRACK),
+      COLUMN(ap_sm.lateral_previous.condition.LAND),
+      COLUMN(ap_sm.lateral_previous.condition.FLARE),
+      COLUMN(ap_sm.lateral_previous.condition.ROLL_OUT),
+      COLUMN(ap_sm.lateral_previous.condition.GA_TRACK),
+      COLUMN(ap_sm.lateral_previous.output.mode),
+      COLUMN(ap_sm.lateral_previous.output.mode_reversion),
+      COLUMN(ap_sm.lateral_previous.output.mode_reversion_TRK_FPA),
+      COLUMN(ap_sm.lateral_previous.output.law),
+      COLUMN(ap_sm.lateral_previous.output.Psi_c_deg),
+      COLUMN(ap_sm.vertical.armed.ALT),
+      COLUMN(ap_sm.vertical.armed.ALT_CST),
+      COLUMN(ap_sm.vertical.armed.CLB),
+      COLUMN(ap_sm.vertical.armed.DES),
+      COLUMN(ap_sm.vertical.armed.GS),
+      COLUMN(ap_sm.vertical.condition.ALT),
+      COLUMN(ap_sm.vertical.condition.ALT_CPT),
+      COLUMN(ap_sm.vertical.condition.ALT_CST),
+      COLUMN(ap_sm.vertical.condition.ALT_CST_CPT),
+      COLUMN(ap_sm.vertical.condition.CLB),
+      COLUMN(ap_sm.vertical.condition.DES),
+      COLUMN(ap_sm.vertical.condition.GS_CPT),
+      COLUMN(ap_sm.vertical.condition.GS_TRACK),
+      COLUMN(ap_sm.vertical.condition.LAND),
+      COLUMN(ap_sm.vertical.condition.FLARE),
+      COLUMN(ap_sm.vertical.condition.ROLL_OUT),
+      COLUMN(ap_sm.vertical.condition.SRS),
+      COLUMN(ap_sm.vertical.condition.SRS_GA),
+      COLUMN(ap_sm.vertical.condition.THR_RED),
+      COLUMN(ap_sm.vertical.condition.H_fcu_active),
+      COLUMN(ap_sm.vertical.output.mode),
+      COLUMN(ap_sm.vertical.output.mode_autothrust),
+      COLUMN(ap_sm.vertical.output.mode_reversion),
+      COLUMN(ap_sm.vertical.output.law),
+      COLUMN(ap_sm.vertical.output.H_c_ft),
+      COLUMN(ap_sm.vertical.output.H_dot_c_fpm),
+      COLUMN(ap_sm.vertical.output.FPA_c_deg),
+      COLUMN(ap_sm.vertical.output.V_c_kn),
+      COLUMN(ap_sm.vertical.output.ALT_soft_mode_active),
+      COLUMN(ap_sm.vertical.output.EXPED_mode_active),
+      COLUMN(ap_sm.vertical.output.FD_disconnect),
+      COLUMN(ap_sm.vertical_previous.armed.ALT),
+      COLUMN(ap_sm.vertical_previous.armed.ALT_CST),
+      COLUMN(ap_sm.vertical_previous.armed.CLB),
+      COLUMN(ap_sm.vertical_previous.armed.DES),
+      COLUMN(ap_sm.vertical_previous.armed.GS),
+      COLUMN(ap_sm.vertical_previous.condition.ALT),
+      COLUMN(ap_sm.vertical_previous.condition.ALT_CPT),
+      COLUMN(ap_sm.vertical_previous.condition.ALT_CST),
+      COLUMN(ap_sm.vertical_previous.condition.ALT_CST_CPT),
+      COLUMN(ap_sm.vertical_previous.condition.CLB),
+      COLUMN(ap_sm.vertical_previous.condition.DES),
+      COLUMN(ap_sm.vertical_previous.condition.GS_CPT),
+      COLUMN(ap_sm.vertical_previous.condition.GS_TRACK),
+      COLUMN(ap_sm.vertical_previous.condition.LAND),
+      COLUMN(ap_sm.vertical_previous.condition.FLARE),
+      COLUMN(ap_sm.vertical_previous.condition.ROLL_OUT),
+      COLUMN(ap_sm.vertical_previous.condition.SRS),
+      COLUMN(ap_sm.vertical_previous.condition.SRS_GA),
+      COLUMN(ap_sm.vertical_previous.condition.THR_RED),
+      COLUMN(ap_sm.vertical_previous.condition.H_fcu_active),
+      COLUMN(ap_sm.vertical_previous.output.mode),
+      COLUMN(ap_sm.vertical_previous.output.mode_autothrust),
+      COLUMN(ap_sm.vertical_previous.output.mode_reversion),
+      COLUMN(ap_sm.vertical_previous.output.law),
+      COLUMN(ap_sm.vertical_previous.output.H_c_ft),
+      COLUMN(ap_sm.vertical_previous.output.H_dot_c_fpm),
+      COLUMN(ap_sm.vertical_previous.output.FPA_c_deg),
+      COLUMN(ap_sm.vertical_previous.output.V_c_kn),
+      COLUMN(ap_sm.vertical_previous.output.ALT_soft_mode_active),
+      COLUMN(ap_sm.vertical_previous.output.EXPED_mode_active),
+      COLUMN(ap_sm.vertical_previous.output.FD_disconnect),
+      COLUMN(ap_sm.output.enabled_AP1),
+      COLUMN(ap_sm.output.enabled_AP2),
+      COLUMN(ap_sm.output.lateral_law),
+      COLUMN(ap_sm.output.lateral_mode),
+      COLUMN(ap_sm.output.lateral_mode_armed),
+      COLUMN(ap_sm.output.vertical_law),
+      COLUMN(ap_sm.output.vertical_mode),
+      COLUMN(ap_sm.output.vertical_mode_armed),
+      COLUMN(ap_sm.output.mode_reversion_lateral),
+      COLUMN(ap_sm.output.mode_reversion_vertical),
+      COLUMN(ap_sm.output.mode_reversion_TRK_FPA),
+      COLUMN(ap_sm.output.mode_reversion_triple_click),
+      COLUMN(ap_sm.output.mode_reversion_fma),
+      COLUMN(ap_sm.output.speed_protection_mode),
+      COLUMN(ap_sm.output.autothrust_mode),
+      COLUMN(ap_sm.output.Psi_c_deg),
+      COLUMN(ap_sm.output.H_c_ft),
+      COLUMN(ap_sm.output.H_dot_c_fpm),
+      COLUMN(ap_sm.output.FPA_c_deg),
+      COLUMN(ap_sm.output.V_c_kn),
+      COLUMN(ap_sm.output.ALT_soft_mode_active),
+      COLUMN(ap_sm.output.EXPED_mode_active),
+      COLUMN(ap_sm.output.FD_disconnect),
+      COLUMN(ap_law.ap_on),
+      COLUMN(ap_law.flight_director.Theta_c_deg),
+      COLUMN(ap_law.flight_director.Phi_c_deg),
+      COLUMN(ap_law.flight_director.Beta_c_deg),
+      COLUMN(ap_law.autopilot.Theta_c_deg),
+      COLUMN(ap_law.autopilot.Phi_c_deg),
+      COLUMN(ap_law.autopilot.Beta_c_deg),
+      COLUMN(athr.data.nz_g),
+      COLUMN(athr.data.Theta_deg),
+      COLUMN(athr.data.Phi_deg),
+      COLUMN(athr.data.V_ias_kn),
+      COLUMN(athr.data.V_tas_kn),
+      COLUMN(athr.data.V_mach),
+      COLUMN(athr.data.V_gnd_kn),
+      COLUMN(athr.data.alpha_deg),
+      COLUMN(athr.data.H_ft),
+      COLUMN(athr.data.H_ind_ft),
+      COLUMN(athr.data.H_radio_ft),
+      COLUMN(athr.data.H_dot_fpm),
+      COLUMN(athr.data.ax_m_s2),
+      COLUMN(athr.data.ay_m_s2),
+      COLUMN(athr.data.az_m_s2),
+      COLUMN(athr.data.bx_m_s2),
+      COLUMN(athr.data.by_m_s2),
+      COLUMN(athr.data.bz_m_s2),
+      COLUMN(athr.data.on_ground),
+      COLUMN(athr.data.flap_handle_index),
+      COLUMN(athr.data.is_engine_operative_1),
+      COLUMN(athr.data.is_engine_operative_2),
+      COLUMN(athr.data.commanded_engine_N1_1_percent),
+      COLUMN(athr.data.commanded_engine_N1_2_percent),
+      COLUMN(athr.data.engine_N1_1_percent),
+      COLUMN(athr.data.engine_N1_2_percent),
+      COLUMN(athr.data.TAT_degC),
+      COLUMN(athr.data.OAT_degC),
+      COLUMN(athr.data.ISA_degC),
+      COLUMN(athr.data_computed.TLA_in_active_range),
+      COLUMN(athr.data_computed.is_FLX_active),
+      COLUMN(athr.data_computed.ATHR_push),
+      COLUMN(athr.data_computed.ATHR_disabled),
+      COLUMN(athr.data_computed.time_since_touchdown),
+      COLUMN(athr.input.ATHR_push),
+      COLUMN(athr.input.ATHR_disconnect),
+      COLUMN(athr.input.TLA_1_deg),
+      COLUMN(athr.input.TLA_2_deg),
+      COLUMN(athr.input.V_c_kn),
+      COLUMN(athr.input.V_LS_kn),
+      COLUMN(athr.input.V_MAX_kn),
+      COLUMN(athr.input.thrust_limit_REV_percent),
+      COLUMN(athr.input.thrust_limit_IDLE_percent),
+      COLUMN(athr.input.thrust_limit_CLB_percent),
+      COLUMN(athr.input.thrust_limit_MCT_percent),
+      COLUMN(athr.input.thrust_limit_FLEX_percent),
+      COLUMN(athr.input.thrust_limit_TOGA_percent),
+      COLUMN(athr.input.flex_temperature_degC),
+      COLUMN(athr.input.mode_requested),
+      COLUMN(athr.input.is_mach_mode_active),
+      COLUMN(athr.input.alpha_floor_condition),
+      COLUMN(athr.input.is_approach_mode_active),
+      COLUMN(athr.input.is_SRS_TO_mode_active),
+      COLUMN(athr.input.is_SRS_GA_mode_active),
+      COLUMN(athr.input.thrust_reduction_altitude),
+      COLUMN(athr.input.thrust_reduction_altitude_go_around),
+      COLUMN(athr.input.is_anti_ice_wing_active),
+      COLUMN(athr.input.is_anti_ice_engine_1_active),
+      COLUMN(athr.input.is_anti_ice_engine_2_active),
+      COLUMN(athr.input.is_air_conditioning_1_active),
+      COLUMN(athr.input.is_air_conditioning_2_active),
+      COLUMN(athr.input.FD_active),
+      COLUMN(athr.input.ATHR_reset_disable),
+      COLUMN(athr.output.sim_throttle_lever_1_pos),
+      COLUMN(athr.output.sim_throttle_lever_2_pos),
+      COLUMN(athr.output.sim_thrust_mode_1),
+      COLUMN(athr.output.sim_thrust_mode_2),
+      COLUMN(athr.output.N1_TLA_1_percent),
+      COLUMN(athr.output.N1_TLA_2_percent),
+      COLUMN(athr.output.is_in_reverse_1),
+      COLUMN(athr.output.is_in_reverse_2),
+      COLUMN(athr.output.thrust_limit_type),
+      COLUMN(athr.output.thrust_limit_percent),
+      COLUMN(athr.output.N1_c_1_percent),
+      COLUMN(athr.output.N1_c_2_percent),
+      COLUMN(athr.output.status),
+      COLUMN(athr.output.mode),
+      COLUMN(athr.output.mode_message),
+      COLUMN(athr.output.thrust_lever_warning_flex),
+      COLUMN(athr.output.thrust_lever_warning_toga),
+      COLUMN(fbw.sim.time.monotonic_time),
+      COLUMN(fbw.sim.time.dt),
+      COLUMN(fbw.sim.time.simulation_time),
+      COLUMN(fbw.sim.time.monotonic_time),
+      COLUMN(fbw.sim.data.nz_g),
+      COLUMN(fbw.sim.data.Theta_deg),
+      COLUMN(fbw.sim.data.Phi_deg),
+      COLUMN(fbw.sim.data.q_deg_s),
+      COLUMN(fbw.sim.data.r_deg_s),
+      COLUMN(fbw.sim.data.p_deg_s),
+      COLUMN(fbw.sim.data.qk_deg_s),
+      COLUMN(fbw.sim.data.rk_deg_s),
+      COLUMN(fbw.sim.data.pk_deg_s),
+      COLUMN(fbw.sim.data.qk_dot_deg_s2),
+      COLUMN(fbw.sim.data.rk_dot_deg_s2),
+      COLUMN(fbw.sim.data.pk_dot_deg_s2),
+      COLUMN(fbw.sim.data.psi_magnetic_deg),
+      COLUMN(fbw.sim.data.psi_true_deg),
+      COLUMN(fbw.sim.data.eta_deg),
+      COLUMN(fbw.sim.data.eta_trim_deg),
+      COLUMN(fbw.sim.data.xi_deg),
+      COLUMN(fbw.sim.data.zeta_deg),
+      COLUMN(fbw.sim.data.zeta_trim_deg),
+      COLUMN(fbw.sim.data.alpha_deg),
+      COLUMN(fbw.sim.data.beta_deg),
+      COLUMN(fbw.sim.data.beta_dot_deg_s),
+      COLUMN(fbw.sim.data.V_ias_kn),
+      COLUMN(fbw.sim.data.V_tas_kn),
+      COLUMN(fbw.sim.data.V_mach),
+      COLUMN(fbw.sim.data.H_ft),
+      COLUMN(fbw.sim.data.H_ind_ft),
+      COLUMN(fbw.sim.data.H_radio_ft),
+      COLUMN(fbw.sim.data.CG_percent_MAC),
+      COLUMN(fbw.sim.data.total_weight_kg),
+      COLUMN(fbw.sim.data.gear_strut_compression_0),
+      COLUMN(fbw.sim.data.gear_strut_compression_1),
+      COLUMN(fbw.sim.data.gear_strut_compression_2),
+      COLUMN(fbw.sim.data.flaps_handle_index),
+      COLUMN(fbw.sim.data.spoilers_left_pos),
+      COLUMN(fbw.sim.data.spoilers_right_pos),
+      COLUMN(fbw.sim.data.autopilot_master_on),
+      COLUMN(fbw.sim.data.slew_on),
+      COLUMN(fbw.sim.data.pause_on),
+      COLUMN(fbw.sim.data.tracking_mode_on_override),
+      COLUMN(fbw.sim.data.autopilot_custom_on),
+      COLUMN(fbw.sim.data.autopilot_custom_Theta_c_deg),
+      COLUMN(fbw.sim.data.autopilot_custom_Phi_c_deg),
+      COLUMN(fbw.sim.data.autopilot_custom_Beta_c_deg),
+      COLUMN(fbw.sim.data.simulation_rate),
+      COLUMN(fbw.sim.data.ice_structure_percent),
+      COLUMN(fbw.sim.data.linear_cl_alpha_per_deg),
+      COLUMN(fbw.sim.data.alpha_stall_deg),
+      COLUMN(fbw.sim.data.alpha_zero_lift_deg),
+      COLUMN(fbw.sim.data.ambient_density_kg_per_m3),
+      COLUMN(fbw.sim.data.ambient_pressure_mbar),
+      COLUMN(fbw.sim.data.ambient_temperature_celsius),
+      COLUMN(fbw.sim.data.ambient_wind_x_kn),
+      COLUMN(fbw.sim.data.ambient_wind_y_kn),
+      COLUMN(fbw.sim.data.ambient_wind_z_kn),
+      COLUMN(fbw.sim.data.ambient_wind_velocity_kn),
+      COLUMN(fbw.sim.data.ambient_wind_direction_deg),
+      COLUMN(fbw.sim.data.total_air_temperature_celsius),
+      COLUMN(fbw.sim.data.latitude_deg),
+      COLUMN(fbw.sim.data.longitude_deg),
+      COLUMN(fbw.sim.data.engine_1_thrust_lbf),
+      COLUMN(fbw.sim.data.engine_2_thrust_lbf),
+      COLUMN(fbw.sim.data.thrust_lever_1_pos),
+      COLUMN(fbw.sim.data.thrust_lever_2_pos),
+      COLUMN(fbw.sim.data_computed.on_ground),
+      COLUMN(fbw.sim.data_computed.tracking_mode_on),
+      COLUMN(fbw.sim.data_computed.high_aoa_prot_active),
+      COLUMN(fbw.sim.data_computed.alpha_floor_command),
+      COLUMN(fbw.sim.data_computed.protection_ap_disc),
+      COLUMN(fbw.sim.data_computed.high_speed_prot_active),
+      COLUMN(fbw.sim.data_computed.high_speed_prot_low_kn),
+      COLUMN(fbw.sim.data_computed.high_speed_prot_high_kn),
+      COLUMN(fbw.sim.data_speeds_aoa.v_alpha_max_kn),
+      COLUMN(fbw.sim.data_speeds_aoa.alpha_max_deg),
+      COLUMN(fbw.sim.data_speeds_aoa.v_alpha_prot_kn),
+      COLUMN(fbw.sim.data_speeds_aoa.alpha_prot_deg),
+      COLUMN(fbw.sim.data_speeds_aoa.alpha_floor_deg),
+      COLUMN(fbw.sim.data_speeds_aoa.alpha_filtered_deg),
+      COLUMN(fbw.sim.input.delta_eta_pos),
+      COLUMN(fbw.sim.input.delta_xi_pos),
+      COLUMN(fbw.sim.input.delta_zeta_pos),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_limit_lo),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_limit_up),
+      COLUMN(fbw.pitch.data_computed.delta_eta_deg),
+      COLUMN(fbw.pitch.data_computed.in_flight),
+      COLUMN(fbw.pitch.data_computed.in_rotation),
+      COLUMN(fbw.pitch.data_computed.in_flare),
+      COLUMN(fbw.pitch.data_computed.in_flight_gain),
+      COLUMN(fbw.pitch.data_computed.in_rotation_gain),
+      COLUMN(fbw.pitch.data_computed.nz_limit_up_g),
+      COLUMN(fbw.pitch.data_computed.nz_limit_lo_g),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_should_freeze),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_reset),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_reset_deg),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_should_write),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s),
+      COLUMN(fbw.pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s),
+      COLUMN(fbw.pitch.data_computed.flare_Theta_deg),
+      COLUMN(fbw.pitch.data_computed.flare_Theta_c_deg),
+      COLUMN(fbw.pitch.data_computed.flare_Theta_c_rate_deg_s),
+      COLUMN(fbw.pitch.law_rotation.qk_c_deg_s),
+      COLUMN(fbw.pitch.law_rotation.eta_deg),
+      COLUMN(fbw.pitch.law_normal.nz_c_g),
+      COLUMN(fbw.pitch.law_normal.Cstar_g),
+      COLUMN(fbw.pitch.law_normal.protection_alpha_c_deg),
+      COLUMN(fbw.pitch.law_normal.protection_V_c_kn),
+      COLUMN(fbw.pitch.law_normal.eta_dot_deg_s),
+      COLUMN(fbw.pitch.vote.eta_dot_deg_s),
+      COLUMN(fbw.pitch.integrated.eta_deg),
+      COLUMN(fbw.pitch.output.eta_deg),
+      COLUMN(fbw.pitch.output.eta_trim_deg),
+      COLUMN(fbw.roll.data_computed.delta_xi_deg),
+      COLUMN(fbw.roll.data_computed.delta_zeta_deg),
+      COLUMN(fbw.roll.data_computed.in_flight),
+      COLUMN(fbw.roll.data_computed.in_flight_gain),
+      COLUMN(fbw.roll.data_computed.zeta_trim_deg_should_write),
+      COLUMN(fbw.roll.data_computed.beta_target_deg),
+      COLUMN(fbw.roll.law_normal.pk_c_deg_s),
+      COLUMN(fbw.roll.law_normal.Phi_c_deg),
+      COLUMN(fbw.roll.law_normal.xi_deg),
+      COLUMN(fbw.roll.law_normal.zeta_deg),
+      COLUMN(fbw.roll.law_normal.zeta_tc_yd_deg),
+      COLUMN(fbw.roll.output.xi_deg),
+      COLUMN(fbw.roll.output.zeta_deg),
+      COLUMN(fbw.roll.output.zeta_trim_deg),
+      COLUMN(fbw.output.eta_pos),
+      COLUMN(fbw.output.eta_trim_deg),
+      COLUMN(fbw.output.eta_trim_deg_should_write),
+      COLUMN(fbw.output.xi_pos),
+      COLUMN(fbw.output.zeta_pos),
+      COLUMN(fbw.output.zeta_trim_pos),
+      COLUMN(fbw.output.zeta_trim_pos_should_write),
+      COLUMN(engine.simOnGround),
+      COLUMN(engine.generalEngineElapsedTime_1),
+      COLUMN(engine.generalEngineElapsedTime_2),
+      COLUMN(engine.standardAtmTemperature),
+      COLUMN(engine.turbineEngineCorrectedFuelFlow_1),
+      COLUMN(engine.turbineEngineCorrectedFuelFlow_2),
+      COLUMN(engine.fuelTankCapacityAuxLeft),
+      COLUMN(engine.fuelTankCapacityAuxRight),
+      COLUMN(engine.fuelTankCapacityMainLeft),
+      COLUMN(engine.fuelTankCapacityMainRight),
+      COLUMN(engine.fuelTankCapacityCenter),
+      COLUMN(engine.fuelTankQuantityAuxLeft),
+      COLUMN(engine.fuelTankQuantityAuxRight),
+      COLUMN(engine.fuelTankQuantityMainLeft),
+      COLUMN(engine.fuelTankQuantityMainRight),
+      COLUMN(engine.fuelTankQuantityCenter),
+      COLUMN(engine.fuelTankQuantityTotal),
+      COLUMN(engine.fuelWeightPerGallon),
+      COLUMN(engine.engineEngine1N2),
+      COLUMN(engine.engineEngine2N2),
+      COLUMN(engine.engineEngine1N1),
+      COLUMN(engine.engineEngine2N1),
+      COLUMN(engine.engineEngineIdleN1),
+      COLUMN(engine.engineEngineIdleN2),
+      COLUMN(engine.engineEngineIdleFF),
+      COLUMN(engine.engineEngineIdleEGT),
+      COLUMN(engine.engineEngine1EGT),
+      COLUMN(engine.engineEngine2EGT),
+      COLUMN(engine.engineEngine1Oil),
+      COLUMN(engine.engineEngine2Oil),
+      COLUMN(engine.engineEngine1TotalOil),
+      COLUMN(engine.engineEngine2TotalOil),
+      COLUMN(engine.engineEngine1FF),
+      COLUMN(engine.engineEngine2FF),
+      COLUMN(engine.engineEngine1PreFF),
+      COLUMN(engine.engineEngine2PreFF),
+      COLUMN(engine.engineEngineImbalance),
+      COLUMN(engine.engineFuelUsedLeft),
+      COLUMN(engine.engineFuelUsedRight),
+      COLUMN(engine.engineFuelLeftPre),
+      COLUMN(engine.engineFuelRightPre),
+      COLUMN(engine.engineFuelAuxLeftPre),
+      COLUMN(engine.engineFuelAuxRightPre),
+      COLUMN(engine.engineFuelCenterPre),
+      COLUMN(engine.engineEngineCycleTime),
+      COLUMN(engine.engineEngine1State),
+      COLUMN(engine.engineEngine2State),
+      COLUMN(engine.engineEngine1Timer),
+      COLUMN(engine.engineEngine2Timer),
+  };
+  return columns;
+}
+
+vector<FlightDataRecorderConverter::Column> FlightDataRecorderConverter::getColumns(const vector<FlightDataRecorderSchema::Field>& fields) {
+  vector<Column> columns;
+  columns.reserve(fields.size());
+  for (const auto& field : fields) {
+    columns.push_back({field.path, field.type, field.offset, COLUMN_FORMAT_NATIVE});
+  }
+  return columns;
 }
 
-void FlightDataRecorderConverter::writeStruct(ofstream& out,
-                                              const string& delimiter,
-                                              const ap_sm_output& ap_sm,
-                                              const ap_raw_output& ap_law,
-                                              const athr_out& athr,
-                                              const fbw_output& fbw,
-                                              const EngineData& engine) {
-  out << ap_sm.time.dt << delimiter;
-  out << ap_sm.time.simulation_time << delimiter;
-  out << ap_sm.data.aircraft_position.lat << delimiter;
-  out << ap_sm.data.aircraft_position.lon << delimiter;
-  out << ap_sm.data.aircraft_position.alt << delimiter;
-  out << ap_sm.data.Theta_deg << delimiter;
-  out << ap_sm.data.Phi_deg << delimiter;
-  out << ap_sm.data.qk_deg_s << delimiter;
-  out << ap_sm.data.rk_deg_s << delimiter;
-  out << ap_sm.data.pk_deg_s << delimiter;
-  out << ap_sm.data.V_ias_kn << delimiter;
-  out << ap_sm.data.V_tas_kn << delimiter;
-  out << ap_sm.data.V_mach << delimiter;
-  out << ap_sm.data.V_gnd_kn << delimiter;
-  out << ap_sm.data.alpha_deg << delimiter;
-  out << ap_sm.data.beta_deg << delimiter;
-  out << ap_sm.data.H_ft << delimiter;
-  out << ap_sm.data.H_ind_ft << delimiter;
-  out << ap_sm.data.H_radio_ft << delimiter;
-  out << ap_sm.data.H_dot_ft_min << delimiter;
-  out << ap_sm.data.Psi_magnetic_deg << delimiter;
-  out << ap_sm.data.Psi_magnetic_track_deg << delimiter;
-  out << ap_sm.data.Psi_true_deg << delimiter;
-  out << ap_sm.data.bx_m_s2 << delimiter;
-  out << ap_sm.data.by_m_s2 << delimiter;
-  out << ap_sm.data.bz_m_s2 << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_valid) << delimiter;
-  out << ap_sm.data.nav_loc_deg << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_dme_valid) << delimiter;
-  out << ap_sm.data.nav_dme_nmi << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_loc_valid) << delimiter;
-  out << ap_sm.data.nav_loc_magvar_deg << delimiter;
-  out << ap_sm.data.nav_loc_error_deg << delimiter;
-  out << ap_sm.data.nav_loc_position.lat << delimiter;
-  out << ap_sm.data.nav_loc_position.lon << delimiter;
-  out << ap_sm.data.nav_loc_position.alt << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_e_loc_valid) << delimiter;
-  out << ap_sm.data.nav_e_loc_error_deg << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_gs_valid) << delimiter;
-  out << ap_sm.data.nav_gs_error_deg << delimiter;
-  out << ap_sm.data.nav_gs_position.lat << delimiter;
-  out << ap_sm.data.nav_gs_position.lon << delimiter;
-  out << ap_sm.data.nav_gs_position.alt << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.nav_e_gs_valid) << delimiter;
-  out << ap_sm.data.nav_e_gs_error_deg << delimiter;
-  out << ap_sm.data.flight_guidance_xtk_nmi << delimiter;
-  out << ap_sm.data.flight_guidance_tae_deg << delimiter;
-  out << ap_sm.data.flight_phase << delimiter;
-  out << ap_sm.data.V2_kn << delimiter;
-  out << ap_sm.data.VAPP_kn << delimiter;
-  out << ap_sm.data.VLS_kn << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data.is_flight_plan_available) << delimiter;
-  out << ap_sm.data.altitude_constraint_ft << delimiter;
-  out << ap_sm.data.thrust_reduction_altitude << delimiter;
-  out << ap_sm.data.thrust_reduction_altitude_go_around << delimiter;
-  out << ap_sm.data.acceleration_altitude << delimiter;
-  out << ap_sm.data.acceleration_altitude_engine_out << delimiter;
-  out << ap_sm.data.acceleration_altitude_go_around << delimiter;
-  out << ap_sm.data.cruise_altitude << delimiter;
-  out << ap_sm.data.on_ground << delimiter;
-  out << ap_sm.data.zeta_deg << delimiter;
-  out << ap_sm.data.throttle_lever_1_pos << delimiter;
-  out << ap_sm.data.throttle_lever_2_pos << delimiter;
-  out << ap_sm.data.flaps_handle_index << delimiter;
-  out << ap_sm.data_computed.time_since_touchdown << delimiter;
-  out << ap_sm.data_computed.time_since_lift_off << delimiter;
-  out << ap_sm.data_computed.time_since_SRS << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data_computed.H_fcu_in_selection) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data_computed.H_constraint_valid) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data_computed.Psi_fcu_in_selection) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data_computed.gs_convergent_towards_beam) << delimiter;
-  out << ap_sm.data_computed.H_dot_radio_fpm << delimiter;
-  out << static_cast<unsigned int>(ap_sm.data_computed.V_fcu_in_selection) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.FD_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.AP_1_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.AP_2_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.AP_DISCONNECT_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.HDG_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.HDG_pull) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.ALT_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.ALT_pull) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.VS_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.VS_pull) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.LOC_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.APPR_push) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.EXPED_push) << delimiter;
-  out << ap_sm.input.V_fcu_kn << delimiter;
-  out << ap_sm.input.Psi_fcu_deg << delimiter;
-  out << ap_sm.input.H_fcu_ft << delimiter;
-  out << ap_sm.input.H_constraint_ft << delimiter;
-  out << ap_sm.input.H_dot_fcu_fpm << delimiter;
-  out << ap_sm.input.FPA_fcu_deg << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.TRK_FPA_mode) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.DIR_TO_trigger) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.is_FLX_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.Slew_trigger) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.MACH_mode) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.ATHR_engaged) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.is_SPEED_managed) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.input.FDR_event) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.armed.NAV) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.armed.LOC) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.NAV) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.LOC_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.LOC_TRACK) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.LAND) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.FLARE) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.ROLL_OUT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.condition.GA_TRACK) << delimiter;
-  out << ap_sm.lateral.output.mode << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.output.mode_reversion) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral.output.mode_reversion_TRK_FPA) << delimiter;
-  out << ap_sm.lateral.output.law << delimiter;
-  out << ap_sm.lateral.output.Psi_c_deg << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.armed.NAV) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.armed.LOC) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.NAV) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.LOC_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.LOC_TRACK) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.LAND) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.FLARE) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.ROLL_OUT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.condition.GA_TRACK) << delimiter;
-  out << ap_sm.lateral_previous.output.mode << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.output.mode_reversion) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.lateral_previous.output.mode_reversion_TRK_FPA) << delimiter;
-  out << ap_sm.lateral_previous.output.law << delimiter;
-  out << ap_sm.lateral_previous.output.Psi_c_deg << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.armed.ALT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.armed.ALT_CST) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.armed.CLB) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.armed.DES) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.armed.GS) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.ALT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.ALT_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.ALT_CST) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.ALT_CST_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.CLB) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.DES) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.GS_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.GS_TRACK) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.LAND) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.FLARE) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.ROLL_OUT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.SRS) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.SRS_GA) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.THR_RED) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.condition.H_fcu_active) << delimiter;
-  out << ap_sm.vertical.output.mode << delimiter;
-  out << ap_sm.vertical.output.mode_autothrust << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.output.mode_reversion) << delimiter;
-  out << ap_sm.vertical.output.law << delimiter;
-  out << ap_sm.vertical.output.H_c_ft << delimiter;
-  out << ap_sm.vertical.output.H_dot_c_fpm << delimiter;
-  out << ap_sm.vertical.output.FPA_c_deg << delimiter;
-  out << ap_sm.vertical.output.V_c_kn << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.output.ALT_soft_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.output.EXPED_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical.output.FD_disconnect) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.armed.ALT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.armed.ALT_CST) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.armed.CLB) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.armed.DES) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.armed.GS) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.ALT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.ALT_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.ALT_CST) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.ALT_CST_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.CLB) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.DES) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.GS_CPT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.GS_TRACK) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.LAND) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.FLARE) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.ROLL_OUT) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.SRS) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.SRS_GA) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.THR_RED) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.condition.H_fcu_active) << delimiter;
-  out << ap_sm.vertical_previous.output.mode << delimiter;
-  out << ap_sm.vertical_previous.output.mode_autothrust << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.output.mode_reversion) << delimiter;
-  out << ap_sm.vertical_previous.output.law << delimiter;
-  out << ap_sm.vertical_previous.output.H_c_ft << delimiter;
-  out << ap_sm.vertical_previous.output.H_dot_c_fpm << delimiter;
-  out << ap_sm.vertical_previous.output.FPA_c_deg << delimiter;
-  out << ap_sm.vertical_previous.output.V_c_kn << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.output.ALT_soft_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.output.EXPED_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.vertical_previous.output.FD_disconnect) << delimiter;
-  out << ap_sm.output.enabled_AP1 << delimiter;
-  out << ap_sm.output.enabled_AP2 << delimiter;
-  out << ap_sm.output.lateral_law << delimiter;
-  out << ap_sm.output.lateral_mode << delimiter;
-  out << ap_sm.output.lateral_mode_armed << delimiter;
-  out << ap_sm.output.vertical_law << delimiter;
-  out << ap_sm.output.vertical_mode << delimiter;
-  out << ap_sm.output.vertical_mode_armed << delimiter;
-  out << ap_sm.output.mode_reversion_lateral << delimiter;
-  out << ap_sm.output.mode_reversion_vertical << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.mode_reversion_TRK_FPA) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.mode_reversion_triple_click) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.mode_reversion_fma) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.speed_protection_mode) << delimiter;
-  out << ap_sm.output.autothrust_mode << delimiter;
-  out << ap_sm.output.Psi_c_deg << delimiter;
-  out << ap_sm.output.H_c_ft << delimiter;
-  out << ap_sm.output.H_dot_c_fpm << delimiter;
-  out << ap_sm.output.FPA_c_deg << delimiter;
-  out << ap_sm.output.V_c_kn << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.ALT_soft_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.EXPED_mode_active) << delimiter;
-  out << static_cast<unsigned int>(ap_sm.output.FD_disconnect) << delimiter;
-  out << ap_law.ap_on << delimiter;
-  out << ap_law.flight_director.Theta_c_deg << delimiter;
-  out << ap_law.flight_director.Phi_c_deg << delimiter;
-  out << ap_law.flight_director.Beta_c_deg << delimiter;
-  out << ap_law.autopilot.Theta_c_deg << delimiter;
-  out << ap_law.autopilot.Phi_c_deg << delimiter;
-  out << ap_law.autopilot.Beta_c_deg << delimiter;
-  out << athr.data.nz_g << delimiter;
-  out << athr.data.Theta_deg << delimiter;
-  out << athr.data.Phi_deg << delimiter;
-  out << athr.data.V_ias_kn << delimiter;
-  out << athr.data.V_tas_kn << delimiter;
-  out << athr.data.V_mach << delimiter;
-  out << athr.data.V_gnd_kn << delimiter;
-  out << athr.data.alpha_deg << delimiter;
-  out << athr.data.H_ft << delimiter;
-  out << athr.data.H_ind_ft << delimiter;
-  out << athr.data.H_radio_ft << delimiter;
-  out << athr.data.H_dot_fpm << delimiter;
-  out << athr.data.ax_m_s2 << delimiter;
-  out << athr.data.ay_m_s2 << delimiter;
-  out << athr.data.az_m_s2 << delimiter;
-  out << athr.data.bx_m_s2 << delimiter;
-  out << athr.data.by_m_s2 << delimiter;
-  out << athr.data.bz_m_s2 << delimiter;
-  out << static_cast<unsigned int>(athr.data.on_ground) << delimiter;
-  out << athr.data.flap_handle_index << delimiter;
-  out << static_cast<unsigned int>(athr.data.is_engine_operative_1) << delimiter;
-  out << static_cast<unsigned int>(athr.data.is_engine_operative_2) << delimiter;
-  out << athr.data.commanded_engine_N1_1_percent << delimiter;
-  out << athr.data.commanded_engine_N1_2_percent << delimiter;
-  out << athr.data.engine_N1_1_percent << delimiter;
-  out << athr.data.engine_N1_2_percent << delimiter;
-  out << athr.data.TAT_degC << delimiter;
-  out << athr.data.OAT_degC << delimiter;
-  out << athr.data.ISA_degC << delimiter;
-  out << static_cast<unsigned int>(athr.data_computed.TLA_in_active_range) << delimiter;
-  out << static_cast<unsigned int>(athr.data_computed.is_FLX_active) << delimiter;
-  out << static_cast<unsigned int>(athr.data_computed.ATHR_push) << delimiter;
-  out << static_cast<unsigned int>(athr.data_computed.ATHR_disabled) << delimiter;
-  out << athr.data_computed.time_since_touchdown << delimiter;
-  out << static_cast<unsigned int>(athr.input.ATHR_push) << delimiter;
-  out << static_cast<unsigned int>(athr.input.ATHR_disconnect) << delimiter;
-  out << athr.input.TLA_1_deg << delimiter;
-  out << athr.input.TLA_2_deg << delimiter;
-  out << athr.input.V_c_kn << delimiter;
-  out << athr.input.V_LS_kn << delimiter;
-  out << athr.input.V_MAX_kn << delimiter;
-  out << athr.input.thrust_limit_REV_percent << delimiter;
-  out << athr.input.thrust_limit_IDLE_percent << delimiter;
-  out << athr.input.thrust_limit_CLB_percent << delimiter;
-  out << athr.input.thrust_limit_MCT_percent << delimiter;
-  out << athr.input.thrust_limit_FLEX_percent << delimiter;
-  out << athr.input.thrust_limit_TOGA_percent << delimiter;
-  out << athr.input.flex_temperature_degC << delimiter;
-  out << athr.input.mode_requested << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_mach_mode_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.alpha_floor_condition) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_approach_mode_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_SRS_TO_mode_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_SRS_GA_mode_active) << delimiter;
-  out << athr.input.thrust_reduction_altitude << delimiter;
-  out << athr.input.thrust_reduction_altitude_go_around << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_anti_ice_wing_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_anti_ice_engine_1_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_anti_ice_engine_2_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_air_conditioning_1_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.is_air_conditioning_2_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.FD_active) << delimiter;
-  out << static_cast<unsigned int>(athr.input.ATHR_reset_disable) << delimiter;
-  out << athr.output.sim_throttle_lever_1_pos << delimiter;
-  out << athr.output.sim_throttle_lever_2_pos << delimiter;
-  out << athr.output.sim_thrust_mode_1 << delimiter;
-  out << athr.output.sim_thrust_mode_2 << delimiter;
-  out << athr.output.N1_TLA_1_percent << delimiter;
-  out << athr.output.N1_TLA_2_percent << delimiter;
-  out << static_cast<unsigned int>(athr.output.is_in_reverse_1) << delimiter;
-  out << static_cast<unsigned int>(athr.output.is_in_reverse_2) << delimiter;
-  out << athr.output.thrust_limit_type << delimiter;
-  out << athr.output.thrust_limit_percent << delimiter;
-  out << athr.output.N1_c_1_percent << delimiter;
-  out << athr.output.N1_c_2_percent << delimiter;
-  out << athr.output.status << delimiter;
-  out << athr.output.mode << delimiter;
-  out << athr.output.mode_message << delimiter;
-  out << static_cast<unsigned int>(athr.output.thrust_lever_warning_flex) << delimiter;
-  out << static_cast<unsigned int>(athr.output.thrust_lever_warning_toga) << delimiter;
-  out << fbw.sim.time.monotonic_time << delimiter;
-  out << fbw.sim.time.dt << delimiter;
-  out << fbw.sim.time.simulation_time << delimiter;
-  out << fbw.sim.time.monotonic_time << delimiter;
-  out << fbw.sim.data.nz_g << delimiter;
-  out << fbw.sim.data.Theta_deg << delimiter;
-  out << fbw.sim.data.Phi_deg << delimiter;
-  out << fbw.sim.data.q_deg_s << delimiter;
-  out << fbw.sim.data.r_deg_s << delimiter;
-  out << fbw.sim.data.p_deg_s << delimiter;
-  out << fbw.sim.data.qk_deg_s << delimiter;
-  out << fbw.sim.data.rk_deg_s << delimiter;
-  out << fbw.sim.data.pk_deg_s << delimiter;
-  out << fbw.sim.data.qk_dot_deg_s2 << delimiter;
-  out << fbw.sim.data.rk_dot_deg_s2 << delimiter;
-  out << fbw.sim.data.pk_dot_deg_s2 << delimiter;
-  out << fbw.sim.data.psi_magnetic_deg << delimiter;
-  out << fbw.sim.data.psi_true_deg << delimiter;
-  out << fbw.sim.data.eta_deg << delimiter;
-  out << fbw.sim.data.eta_trim_deg << delimiter;
-  out << fbw.sim.data.xi_deg << delimiter;
-  out << fbw.sim.data.zeta_deg << delimiter;
-  out << fbw.sim.data.zeta_trim_deg << delimiter;
-  out << fbw.sim.data.alpha_deg << delimiter;
-  out << fbw.sim.data.beta_deg << delimiter;
-  out << fbw.sim.data.beta_dot_deg_s << delimiter;
-  out << fbw.sim.data.V_ias_kn << delimiter;
-  out << fbw.sim.data.V_tas_kn << delimiter;
-  out << fbw.sim.data.V_mach << delimiter;
-  out << fbw.sim.data.H_ft << delimiter;
-  out << fbw.sim.data.H_ind_ft << delimiter;
-  out << fbw.sim.data.H_radio_ft << delimiter;
-  out << fbw.sim.data.CG_percent_MAC << delimiter;
-  out << fbw.sim.data.total_weight_kg << delimiter;
-  out << fbw.sim.data.gear_strut_compression_0 << delimiter;
-  out << fbw.sim.data.gear_strut_compression_1 << delimiter;
-  out << fbw.sim.data.gear_strut_compression_2 << delimiter;
-  out << fbw.sim.data.flaps_handle_index << delimiter;
-  out << fbw.sim.data.spoilers_left_pos << delimiter;
-  out << fbw.sim.data.spoilers_right_pos << delimiter;
-  out << fbw.sim.data.autopilot_master_on << delimiter;
-  out << fbw.sim.data.slew_on << delimiter;
-  out << fbw.sim.data.pause_on << delimiter;
-  out << fbw.sim.data.tracking_mode_on_override << delimiter;
-  out << fbw.sim.data.autopilot_custom_on << delimiter;
-  out << fbw.sim.data.autopilot_custom_Theta_c_deg << delimiter;
-  out << fbw.sim.data.autopilot_custom_Phi_c_deg << delimiter;
-  out << fbw.sim.data.autopilot_custom_Beta_c_deg << delimiter;
-  out << fbw.sim.data.simulation_rate << delimiter;
-  out << fbw.sim.data.ice_structure_percent << delimiter;
-  out << fbw.sim.data.linear_cl_alpha_per_deg << delimiter;
-  out << fbw.sim.data.alpha_stall_deg << delimiter;
-  out << fbw.sim.data.alpha_zero_lift_deg << delimiter;
-  out << fbw.sim.data.ambient_density_kg_per_m3 << delimiter;
-  out << fbw.sim.data.ambient_pressure_mbar << delimiter;
-  out << fbw.sim.data.ambient_temperature_celsius << delimiter;
-  out << fbw.sim.data.ambient_wind_x_kn << delimiter;
-  out << fbw.sim.data.ambient_wind_y_kn << delimiter;
-  out << fbw.sim.data.ambient_wind_z_kn << delimiter;
-  out << fbw.sim.data.ambient_wind_velocity_kn << delimiter;
-  out << fbw.sim.data.ambient_wind_direction_deg << delimiter;
-  out << fbw.sim.data.total_air_temperature_celsius << delimiter;
-  out << fbw.sim.data.latitude_deg << delimiter;
-  out << fbw.sim.data.longitude_deg << delimiter;
-  out << fbw.sim.data.engine_1_thrust_lbf << delimiter;
-  out << fbw.sim.data.engine_2_thrust_lbf << delimiter;
-  out << fbw.sim.data.thrust_lever_1_pos << delimiter;
-  out << fbw.sim.data.thrust_lever_2_pos << delimiter;
-  out << fbw.sim.data_computed.on_ground << delimiter;
-  out << fbw.sim.data_computed.tracking_mode_on << delimiter;
-  out << fbw.sim.data_computed.high_aoa_prot_active << delimiter;
-  out << fbw.sim.data_computed.alpha_floor_command << delimiter;
-  out << fbw.sim.data_computed.protection_ap_disc << delimiter;
-  out << fbw.sim.data_computed.high_speed_prot_active << delimiter;
-  out << fbw.sim.data_computed.high_speed_prot_low_kn << delimiter;
-  out << fbw.sim.data_computed.high_speed_prot_high_kn << delimiter;
-  out << fbw.sim.data_speeds_aoa.v_alpha_max_kn << delimiter;
-  out << fbw.sim.data_speeds_aoa.alpha_max_deg << delimiter;
-  out << fbw.sim.data_speeds_aoa.v_alpha_prot_kn << delimiter;
-  out << fbw.sim.data_speeds_aoa.alpha_prot_deg << delimiter;
-  out << fbw.sim.data_speeds_aoa.alpha_floor_deg << delimiter;
-  out << fbw.sim.data_speeds_aoa.alpha_filtered_deg << delimiter;
-  out << fbw.sim.input.delta_eta_pos << delimiter;
-  out << fbw.sim.input.delta_xi_pos << delimiter;
-  out << fbw.sim.input.delta_zeta_pos << delimiter;
-  out << fbw.pitch.data_computed.eta_trim_deg_limit_lo << delimiter;
-  out << fbw.pitch.data_computed.eta_trim_deg_limit_up << delimiter;
-  out << fbw.pitch.data_computed.delta_eta_deg << delimiter;
-  out << fbw.pitch.data_computed.in_flight << delimiter;
-  out << fbw.pitch.data_computed.in_rotation << delimiter;
-  out << fbw.pitch.data_computed.in_flare << delimiter;
-  out << fbw.pitch.data_computed.in_flight_gain << delimiter;
-  out << fbw.pitch.data_computed.in_rotation_gain << delimiter;
-  out << fbw.pitch.data_computed.nz_limit_up_g << delimiter;
-  out << fbw.pitch.data_computed.nz_limit_lo_g << delimiter;
-  out << static_cast<unsigned int>(fbw.pitch.data_computed.eta_trim_deg_should_freeze) << delimiter;
-  out << static_cast<unsigned int>(fbw.pitch.data_computed.eta_trim_deg_reset) << delimiter;
-  out << fbw.pitch.data_computed.eta_trim_deg_reset_deg << delimiter;
-  out << static_cast<unsigned int>(fbw.pitch.data_computed.eta_trim_deg_should_write) << delimiter;
-  out << fbw.pitch.data_computed.eta_trim_deg_rate_limit_up_deg_s << delimiter;
-  out << fbw.pitch.data_computed.eta_trim_deg_rate_limit_lo_deg_s << delimiter;
-  out << fbw.pitch.data_computed.flare_Theta_deg << delimiter;
-  out << fbw.pitch.data_computed.flare_Theta_c_deg << delimiter;
-  out << fbw.pitch.data_computed.flare_Theta_c_rate_deg_s << delimiter;
-  out << fbw.pitch.law_rotation.qk_c_deg_s << delimiter;
-  out << fbw.pitch.law_rotation.eta_deg << delimiter;
-  out << fbw.pitch.law_normal.nz_c_g << delimiter;
-  out << fbw.pitch.law_normal.Cstar_g << delimiter;
-  out << fbw.pitch.law_normal.protection_alpha_c_deg << delimiter;
-  out << fbw.pitch.law_normal.protection_V_c_kn << delimiter;
-  out << fbw.pitch.law_normal.eta_dot_deg_s << delimiter;
-  out << fbw.pitch.vote.eta_dot_deg_s << delimiter;
-  out << fbw.pitch.integrated.eta_deg << delimiter;
-  out << fbw.pitch.output.eta_deg << delimiter;
-  out << fbw.pitch.output.eta_trim_deg << delimiter;
-  out << fbw.roll.data_computed.delta_xi_deg << delimiter;
-  out << fbw.roll.data_computed.delta_zeta_deg << delimiter;
-  out << fbw.roll.data_computed.in_flight << delimiter;
-  out << fbw.roll.data_computed.in_flight_gain << delimiter;
-  out << static_cast<unsigned int>(fbw.roll.data_computed.zeta_trim_deg_should_write) << delimiter;
-  out << fbw.roll.data_computed.beta_target_deg << delimiter;
-  out << fbw.roll.law_normal.pk_c_deg_s << delimiter;
-  out << fbw.roll.law_normal.Phi_c_deg << delimiter;
-  out << fbw.roll.law_normal.xi_deg << delimiter;
-  out << fbw.roll.law_normal.zeta_deg << delimiter;
-  out << fbw.roll.law_normal.zeta_tc_yd_deg << delimiter;
-  out << fbw.roll.output.xi_deg << delimiter;
-  out << fbw.roll.output.zeta_deg << delimiter;
-  out << fbw.roll.output.zeta_trim_deg << delimiter;
-  out << fbw.output.eta_pos << delimiter;
-  out << fbw.output.eta_trim_deg << delimiter;
-  out << static_cast<unsigned int>(fbw.output.eta_trim_deg_should_write) << delimiter;
-  out << fbw.output.xi_pos << delimiter;
-  out << fbw.output.zeta_pos << delimiter;
-  out << fbw.output.zeta_trim_pos << delimiter;
-  out << static_cast<unsigned int>(fbw.output.zeta_trim_pos_should_write) << delimiter;
-  out << engine.simOnGround << delimiter;
-  out << engine.generalEngineElapsedTime_1 << delimiter;
-  out << engine.generalEngineElapsedTime_2 << delimiter;
-  out << engine.standardAtmTemperature << delimiter;
-  out << engine.turbineEngineCorrectedFuelFlow_1 << delimiter;
-  out << engine.turbineEngineCorrectedFuelFlow_2 << delimiter;
-  out << engine.fuelTankCapacityAuxLeft << delimiter;
-  out << engine.fuelTankCapacityAuxRight << delimiter;
-  out << engine.fuelTankCapacityMainLeft << delimiter;
-  out << engine.fuelTankCapacityMainRight << delimiter;
-  out << engine.fuelTankCapacityCenter << delimiter;
-  out << engine.fuelTankQuantityAuxLeft << delimiter;
-  out << engine.fuelTankQuantityAuxRight << delimiter;
-  out << engine.fuelTankQuantityMainLeft << delimiter;
-  out << engine.fuelTankQuantityMainRight << delimiter;
-  out << engine.fuelTankQuantityCenter << delimiter;
-  out << engine.fuelTankQuantityTotal << delimiter;
-  out << engine.fuelWeightPerGallon << delimiter;
-  out << engine.engineEngine1N2 << delimiter;
-  out << engine.engineEngine2N2 << delimiter;
-  out << engine.engineEngine1N1 << delimiter;
-  out << engine.engineEngine2N1 << delimiter;
-  out << engine.engineEngineIdleN1 << delimiter;
-  out << engine.engineEngineIdleN2 << delimiter;
-  out << engine.engineEngineIdleFF << delimiter;
-  out << engine.engineEngineIdleEGT << delimiter;
-  out << engine.engineEngine1EGT << delimiter;
-  out << engine.engineEngine2EGT << delimiter;
-  out << engine.engineEngine1Oil << delimiter;
-  out << engine.engineEngine2Oil << delimiter;
-  out << engine.engineEngine1TotalOil << delimiter;
-  out << engine.engineEngine2TotalOil << delimiter;
-  out << engine.engineEngine1FF << delimiter;
-  out << engine.engineEngine2FF << delimiter;
-  out << engine.engineEngine1PreFF << delimiter;
-  out << engine.engineEngine2PreFF << delimiter;
-  out << engine.engineEngineImbalance << delimiter;
-  out << engine.engineFuelUsedLeft << delimiter;
-  out << engine.engineFuelUsedRight << delimiter;
-  out << engine.engineFuelLeftPre << delimiter;
-  out << engine.engineFuelRightPre << delimiter;
-  out << engine.engineFuelAuxLeftPre << delimiter;
-  out << engine.engineFuelAuxRightPre << delimiter;
-  out << engine.engineFuelCenterPre << delimiter;
-  out << engine.engineEngineCycleTime << delimiter;
-  out << engine.engineEngine1State << delimiter;
-  out << engine.engineEngine2State << delimiter;
-  out << engine.engineEngine1Timer << delimiter;
-  out << engine.engineEngine2Timer << delimiter;
+void FlightDataRecorderConverter::writeHeader(ostream& out, const string& delimiter, const vector<Column>& columns) {
+  for (const auto& column : columns) {
+    out << column.name << delimiter;
+  }
   out << endl;
 }
+
+template <typename T>
+static T readValue(const unsigned char* sample, uint32_t offset) {
+  T value;
+  memcpy(&value, sample + offset, sizeof(value));
+  return value;
+}
+
+char* FlightDataRecorderConverter::writeValue(char* position, char* end, const Column& column, const unsigned char* sample) {
+  switch (column.type) {
+    case FlightDataRecorderSchema::FIELD_TYPE_REAL: {
+      // same as the default formatting of streams
+      auto value = readValue<double>(sample, column.offset);
+      if (column.format == COLUMN_FORMAT_UNSIGNED) {
+        return to_chars(position, end, static_cast<uint32_t>(value)).ptr;
+      }
+      return to_chars(position, end, value, chars_format::general, 6).ptr;
+    }
+    case FlightDataRecorderSchema::FIELD_TYPE_BOOLEAN:
+      return to_chars(position, end, static_cast<uint32_t>(readValue<uint8_t>(sample, column.offset))).ptr;
+    case FlightDataRecorderSchema::FIELD_TYPE_INT32:
+      return to_chars(position, end, readValue<int32_t>(sample, column.offset)).ptr;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT32:
+      return to_chars(position, end, readValue<uint32_t>(sample, column.offset)).ptr;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT64:
+      return to_chars(position, end, readValue<uint64_t>(sample, column.offset)).ptr;
+  }
+  return position;
+}
+
+void FlightDataRecorderConverter::writeSample(string& buffer, const string& delimiter, const vector<Column>& columns, const unsigned char* sample) {
+  // reserve space for the longest possible row and cut it to the written length afterwards
+  auto length = buffer.size();
+  buffer.resize(length + columns.size() * (MAXIMUM_VALUE_LENGTH + delimiter.size()) + 1);
+  auto position = &buffer[length];
+  auto end = buffer.data() + buffer.size();
+
+  for (const auto& column : columns) {
+    position = writeValue(position, end, column, sample);
+    memcpy(position, delimiter.data(), delimiter.size());
+    position += delimiter.size();
+  }
+  *position++ = '\n';
+
+  buffer.resize(position - buffer.data());
+}
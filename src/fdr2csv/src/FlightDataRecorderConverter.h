@@ -1,24 +1,48 @@
 #pragma once
 
-#include <fstream>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
 
-#include "AutopilotLaws_types.h"
-#include "AutopilotStateMachine_types.h"
-#include "Autothrust_types.h"
-#include "EngineData.h"
-#include "FlyByWire_types.h"
+#include "FlightDataRecorderSchema.h"
 
+// Writes samples as csv. Every output column is described by one entry of a column table, which drives both the
+// header and the rows. Rows are formatted with std::to_chars into a buffer, so a whole block of samples can be
+// written with a single call.
 class FlightDataRecorderConverter {
  public:
   FlightDataRecorderConverter() = delete;
   ~FlightDataRecorderConverter() = delete;
 
-  static void writeHeader(std::ofstream& out, const std::string& delimiter);
-  static void writeStruct(std::ofstream& out,
-                          const std::string& delimiter,
-                          const ap_sm_output& ap_sm,
-                          const ap_raw_output& ap_law,
-                          const athr_out& athr,
-                          const fbw_output& fbw,
-                          const EngineData& engine);
+  enum ColumnFormat : uint8_t {
+    // value is written according to its type
+    COLUMN_FORMAT_NATIVE = 0,
+    // real value is truncated to an unsigned integer
+    COLUMN_FORMAT_UNSIGNED = 1,
+  };
+
+  struct Column {
+    std::string name;
+    FlightDataRecorderSchema::FieldType type;
+    uint32_t offset;
+    ColumnFormat format;
+  };
+
+  // columns of the csv layout used for files matching the compiled FlightDataRecorderSample
+  static const std::vector<Column>& getLegacyColumns();
+
+  // one column per given field, used for files of other interface versions and for field selections
+  static std::vector<Column> getColumns(const std::vector<FlightDataRecorderSchema::Field>& fields);
+
+  static void writeHeader(std::ostream& out, const std::string& delimiter, const std::vector<Column>& columns);
+
+  // appends one row to the buffer
+  static void writeSample(std::string& buffer, const std::string& delimiter, const std::vector<Column>& columns, const unsigned char* sample);
+
+  // writes the value of one column at the position, returns the end of the text
+  static char* writeValue(char* position, char* end, const Column& column, const unsigned char* sample);
+
+  // longest text of a value, e.g. -1.23457e+308 or 18446744073709551615
+  static constexpr size_t MAXIMUM_VALUE_LENGTH = 24;
 };
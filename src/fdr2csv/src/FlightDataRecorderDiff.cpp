@@ -0,0 +1,106 @@
+#include "FlightDataRecorderDiff.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+template <typename T>
+static void extractValues(const unsigned char* samples, size_t sampleSize, size_t numberOfSamples, uint32_t offset, double* column) {
+  // memcpy avoids unaligned access
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    T value;
+    memcpy(&value, samples + i * sampleSize + offset, sizeof(value));
+    column[i] = static_cast<double>(value);
+  }
+}
+
+void FlightDataRecorderDiff::extractColumn(const FlightDataRecorderSchema::Field& field,
+                                           const unsigned char* samples,
+                                           size_t sampleSize,
+                                           size_t numberOfSamples,
+                                           double* column) {
+  // the type is resolved once per block
+  switch (field.type) {
+    case FlightDataRecorderSchema::FIELD_TYPE_REAL:
+      extractValues<double>(samples, sampleSize, numberOfSamples, field.offset, column);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_BOOLEAN:
+      extractValues<uint8_t>(samples, sampleSize, numberOfSamples, field.offset, column);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_INT32:
+      extractValues<int32_t>(samples, sampleSize, numberOfSamples, field.offset, column);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT32:
+      extractValues<uint32_t>(samples, sampleSize, numberOfSamples, field.offset, column);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT64:
+      extractValues<uint64_t>(samples, sampleSize, numberOfSamples, field.offset, column);
+      break;
+  }
+}
+
+inline double FlightDataRecorderDiff::getError(double expected, double actual) {
+  // selects instead of branches, NaN is the only value not equal to itself
+  auto isExpectedNan = expected != expected;
+  auto isActualNan = actual != actual;
+  auto isEqual = (expected == actual) | (isExpectedNan & isActualNan);
+  auto error = isEqual ? 0.0 : fabs(actual - expected);
+  return isExpectedNan != isActualNan ? numeric_limits<double>::infinity() : error;
+}
+
+inline bool FlightDataRecorderDiff::isDivergent(double error, double expected, const Tolerance& tolerance) {
+  // the threshold is NaN or infinite for a reference value that is, an infinite error diverges regardless
+  return isinf(error) | (error > tolerance.absolute + tolerance.relative * fabs(expected));
+}
+
+void FlightDataRecorderDiff::compare(const double* expected,
+                                     const double* actual,
+                                     const double* simulationTimes,
+                                     size_t numberOfSamples,
+                                     const Tolerance& tolerance,
+                                     uint64_t firstSampleIndex,
+                                     Result& result) {
+  static thread_local vector<double> errors;
+  errors.resize(numberOfSamples);
+
+  // errors and number of divergent values of the block
+  uint64_t numberOfDivergentSamples = 0;
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    auto error = getError(expected[i], actual[i]);
+    errors[i] = error;
+    numberOfDivergentSamples += isDivergent(error, expected[i], tolerance) ? 1 : 0;
+  }
+
+  // errors are never negative or NaN, so their bit patterns are ordered like their values and the maximum is an
+  // integer reduction
+  uint64_t maximumErrorBits = 0;
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    uint64_t errorBits;
+    memcpy(&errorBits, &errors[i], sizeof(errorBits));
+    maximumErrorBits = errorBits > maximumErrorBits ? errorBits : maximumErrorBits;
+  }
+  double maximumError;
+  memcpy(&maximumError, &maximumErrorBits, sizeof(maximumError));
+
+  // positions are searched only in the rare blocks that change the result, the first block sets the position of a
+  // maximum error of zero
+  if (maximumError > result.maximumError || (firstSampleIndex == 0 && numberOfSamples > 0)) {
+    auto index = static_cast<size_t>(find(errors.begin(), errors.end(), maximumError) - errors.begin());
+    result.maximumError = maximumError;
+    result.maximumErrorSample = firstSampleIndex + index;
+    result.maximumErrorTime = simulationTimes != nullptr ? simulationTimes[index] : numeric_limits<double>::quiet_NaN();
+  }
+  if (numberOfDivergentSamples > 0 && result.firstDivergentSample == NO_DIVERGENCE) {
+    for (size_t i = 0; i < numberOfSamples; i++) {
+      if (isDivergent(errors[i], expected[i], tolerance)) {
+        result.firstDivergentSample = firstSampleIndex + i;
+        result.firstDivergentTime = simulationTimes != nullptr ? simulationTimes[i] : numeric_limits<double>::quiet_NaN();
+        break;
+      }
+    }
+  }
+  result.numberOfDivergentSamples += numberOfDivergentSamples;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "FlightDataRecorderSchema.h"
+
+// Field by field comparison of two recordings. Blocks of samples are transposed into one array of doubles per field,
+// so the comparison runs over contiguous columns in loops without branches, which compilers turn into SIMD code.
+// Positions of the largest error and of the first divergence are only searched for in blocks that contain them.
+//
+// A value diverges if |actual - expected| > absolute + relative * |expected|. Equal values, including infinities and
+// NaN on both sides, have no error; NaN on one side only and an infinity against a finite value have an infinite
+// error, which always diverges.
+class FlightDataRecorderDiff {
+ public:
+  FlightDataRecorderDiff() = delete;
+  ~FlightDataRecorderDiff() = delete;
+
+  struct Tolerance {
+    double absolute;
+    double relative;
+  };
+
+  static constexpr uint64_t NO_DIVERGENCE = std::numeric_limits<uint64_t>::max();
+
+  // comparison of one field, accumulated over all blocks, times are NaN without a simulation time column
+  struct Result {
+    double maximumError = 0;
+    uint64_t maximumErrorSample = 0;
+    double maximumErrorTime = std::numeric_limits<double>::quiet_NaN();
+    uint64_t firstDivergentSample = NO_DIVERGENCE;
+    double firstDivergentTime = std::numeric_limits<double>::quiet_NaN();
+    uint64_t numberOfDivergentSamples = 0;
+  };
+
+  // copies one field of consecutive raw samples into a column
+  static void extractColumn(const FlightDataRecorderSchema::Field& field,
+                            const unsigned char* samples,
+                            size_t sampleSize,
+                            size_t numberOfSamples,
+                            double* column);
+
+  // compares a block of a column, the first value has the given sample index within the recording, the simulation
+  // times of the block may be nullptr
+  static void compare(const double* expected,
+                      const double* actual,
+                      const double* simulationTimes,
+                      size_t numberOfSamples,
+                      const Tolerance& tolerance,
+                      uint64_t firstSampleIndex,
+                      Result& result);
+
+ private:
+  static double getError(double expected, double actual);
+  static bool isDivergent(double error, double expected, const Tolerance& tolerance);
+};
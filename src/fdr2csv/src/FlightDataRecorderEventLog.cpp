@@ -0,0 +1,88 @@
+#include "FlightDataRecorderEventLog.h"
+
+#include <cstring>
+
+using namespace std;
+
+FlightDataRecorderEventLog::FlightDataRecorderEventLog(const vector<FlightDataRecorderSchema::Field>& eventFields,
+                                                       const vector<FlightDataRecorderSchema::Field>& contextFields,
+                                                       const FlightDataRecorderSchema::Field* simulationTimeField,
+                                                       const string& eventDelimiter)
+    : fields(eventFields),
+      columns(FlightDataRecorderConverter::getColumns(eventFields)),
+      contextColumns(FlightDataRecorderConverter::getColumns(contextFields)),
+      delimiter(eventDelimiter) {
+  if (simulationTimeField != nullptr) {
+    simulationTimeColumns = FlightDataRecorderConverter::getColumns({*simulationTimeField});
+  }
+}
+
+void FlightDataRecorderEventLog::writeHeader(string& buffer) const {
+  buffer += "simulation_time" + delimiter + "field" + delimiter + "from" + delimiter + "to";
+  for (const auto& column : contextColumns) {
+    buffer += delimiter + column.name;
+  }
+  buffer += "\n";
+}
+
+void FlightDataRecorderEventLog::add(string& buffer, const unsigned char* samples, size_t numberOfSamples, size_t sampleSize) {
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    auto sample = samples + i * sampleSize;
+    const unsigned char* previous = nullptr;
+    if (i > 0) {
+      previous = sample - sampleSize;
+    } else if (!previousSample.empty()) {
+      previous = previousSample.data();
+    }
+
+    // only changed fields are formatted
+    for (size_t j = 0; j < fields.size(); j++) {
+      auto offset = fields[j].offset;
+      if (previous == nullptr || memcmp(previous + offset, sample + offset, fields[j].size) != 0) {
+        writeEvent(buffer, columns[j], previous, sample);
+      }
+    }
+  }
+
+  // the next block is compared against the last sample of this one
+  if (numberOfSamples > 0) {
+    auto last = samples + (numberOfSamples - 1) * sampleSize;
+    previousSample.assign(last, last + sampleSize);
+  }
+}
+
+void FlightDataRecorderEventLog::writeEvent(string& buffer,
+                                            const FlightDataRecorderConverter::Column& column,
+                                            const unsigned char* previous,
+                                            const unsigned char* sample) {
+  // reserve space for the longest possible row and cut it to the written length afterwards
+  auto length = buffer.size();
+  buffer.resize(length + column.name.size() + (contextColumns.size() + 3) * (FlightDataRecorderConverter::MAXIMUM_VALUE_LENGTH + delimiter.size()) +
+                delimiter.size() + 1);
+  auto position = &buffer[length];
+  auto end = buffer.data() + buffer.size();
+  auto writeDelimiter = [this, &position]() {
+    memcpy(position, delimiter.data(), delimiter.size());
+    position += delimiter.size();
+  };
+
+  if (!simulationTimeColumns.empty()) {
+    position = FlightDataRecorderConverter::writeValue(position, end, simulationTimeColumns[0], sample);
+  }
+  writeDelimiter();
+  memcpy(position, column.name.data(), column.name.size());
+  position += column.name.size();
+  writeDelimiter();
+  if (previous != nullptr) {
+    position = FlightDataRecorderConverter::writeValue(position, end, column, previous);
+  }
+  writeDelimiter();
+  position = FlightDataRecorderConverter::writeValue(position, end, column, sample);
+  for (const auto& contextColumn : contextColumns) {
+    writeDelimiter();
+    position = FlightDataRecorderConverter::writeValue(position, end, contextColumn, sample);
+  }
+  *position++ = '\n';
+
+  buffer.resize(position - buffer.data());
+}
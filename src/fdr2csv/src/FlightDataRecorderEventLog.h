@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderSchema.h"
+
+// Extracts transitions of discrete fields like autopilot modes, autothrust status or protection flags. Every change
+// of a watched field becomes one csv row with the simulation time, the values before and after the change and the
+// values of the context fields at the change:
+//
+//   simulation_time,field,from,to,ap_sm.data.H_ind_ft,ap_sm.data.V_ias_kn
+//   0,ap_sm.output.lateral_mode,,0,1000,250
+//   50.556,ap_sm.output.lateral_mode,0,10,1000,251.532
+//
+// The values of the first sample are written with an empty "from" column. Samples are compared field by field and
+// only changed fields are formatted, so the samples have to be passed in the order of the file.
+class FlightDataRecorderEventLog {
+ public:
+  // watched fields if none are given
+  static constexpr const char* DEFAULT_FIELDS =
+      "ap_sm.output.enabled_AP?,ap_sm.output.lateral_mode*,ap_sm.output.vertical_mode*,ap_sm.output.mode_reversion*,"
+      "ap_sm.output.speed_protection_mode,ap_sm.output.autothrust_mode,athr.output.status,athr.output.mode,"
+      "athr.output.mode_message,athr.output.thrust_limit_type,fbw.sim.data.tailstrike_protection_on,"
+      "fbw.sim.data_computed.*_prot_active,fbw.sim.data_computed.alpha_floor_command,fbw.sim.data_computed.protection_ap_disc";
+
+  // context fields if none are given
+  static constexpr const char* DEFAULT_CONTEXT_FIELDS = "ap_sm.data.H_ind_ft,ap_sm.data.V_ias_kn";
+
+  FlightDataRecorderEventLog(const std::vector<FlightDataRecorderSchema::Field>& fields,
+                             const std::vector<FlightDataRecorderSchema::Field>& contextFields,
+                             const FlightDataRecorderSchema::Field* simulationTimeField,
+                             const std::string& delimiter);
+
+  void writeHeader(std::string& buffer) const;
+
+  // appends the transitions within a block of raw samples and against the last sample of the previous block
+  void add(std::string& buffer, const unsigned char* samples, size_t numberOfSamples, size_t sampleSize);
+
+ private:
+  std::vector<FlightDataRecorderSchema::Field> fields;
+  std::vector<FlightDataRecorderConverter::Column> columns;
+  std::vector<FlightDataRecorderConverter::Column> contextColumns;
+  std::vector<FlightDataRecorderConverter::Column> simulationTimeColumns;
+  std::string delimiter;
+
+  // copy of the last sample of the previous block
+  std::vector<unsigned char> previousSample;
+
+  void writeEvent(std::string& buffer,
+                  const FlightDataRecorderConverter::Column& column,
+                  const unsigned char* previous,
+                  const unsigned char* sample);
+};
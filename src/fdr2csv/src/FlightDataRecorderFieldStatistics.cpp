@@ -0,0 +1,172 @@
+#include "FlightDataRecorderFieldStatistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+using namespace std;
+
+FlightDataRecorderFieldStatistics::FlightDataRecorderFieldStatistics(const FlightDataRecorderSchema::Field& statisticsField)
+    : field(statisticsField), levels(1) {
+  levels[0].reserve(LEVEL_CAPACITY);
+}
+
+template <typename T>
+static void addValues(FlightDataRecorderFieldStatistics& statistics,
+                      const unsigned char* samples,
+                      size_t numberOfSamples,
+                      size_t sampleSize,
+                      uint32_t offset) {
+  // memcpy avoids unaligned access
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    T value;
+    memcpy(&value, samples + i * sampleSize + offset, sizeof(value));
+    statistics.add(static_cast<double>(value));
+  }
+}
+
+void FlightDataRecorderFieldStatistics::add(const unsigned char* samples, size_t numberOfSamples, size_t sampleSize) {
+  // the type is resolved once per block
+  switch (field.type) {
+    case FlightDataRecorderSchema::FIELD_TYPE_REAL:
+      addValues<double>(*this, samples, numberOfSamples, sampleSize, field.offset);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_BOOLEAN:
+      addValues<uint8_t>(*this, samples, numberOfSamples, sampleSize, field.offset);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_INT32:
+      addValues<int32_t>(*this, samples, numberOfSamples, sampleSize, field.offset);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT32:
+      addValues<uint32_t>(*this, samples, numberOfSamples, sampleSize, field.offset);
+      break;
+    case FlightDataRecorderSchema::FIELD_TYPE_UINT64:
+      addValues<uint64_t>(*this, samples, numberOfSamples, sampleSize, field.offset);
+      break;
+  }
+}
+
+void FlightDataRecorderFieldStatistics::add(double value) {
+  if (isnan(value)) {
+    return;
+  }
+
+  // running moments, sums are taken relative to the first value to keep the variance accurate for large offsets
+  if (count == 0) {
+    minimum = value;
+    maximum = value;
+    shift = value;
+  }
+  count++;
+  minimum = min(minimum, value);
+  maximum = max(maximum, value);
+  auto delta = value - shift;
+  sum += delta;
+  sumOfSquares += delta * delta;
+
+  // the sketch is only filled once the value changes, many fields stay constant during a flight
+  if (constantCount + 1 == count && value == shift) {
+    constantCount++;
+    return;
+  }
+  for (; constantCount > 0; constantCount--) {
+    addToSketch(shift);
+  }
+  addToSketch(value);
+}
+
+void FlightDataRecorderFieldStatistics::addToSketch(double value) {
+  levels[0].push_back(value);
+  if (levels[0].size() >= LEVEL_CAPACITY) {
+    compact(0);
+  }
+}
+
+void FlightDataRecorderFieldStatistics::compact(size_t level) {
+  if (level + 1 >= levels.size()) {
+    levels.emplace_back();
+    levels.back().reserve(LEVEL_CAPACITY);
+  }
+
+  // promote every other value of the sorted level, the start alternates to avoid a bias towards small or large values
+  // constant and slowly changing values often arrive sorted already
+  auto& values = levels[level];
+  if (!is_sorted(values.begin(), values.end())) {
+    sort(values.begin(), values.end());
+  }
+  auto& next = levels[level + 1];
+  for (size_t i = numberOfCompactions++ % 2; i < values.size(); i += 2) {
+    next.push_back(values[i]);
+  }
+  values.clear();
+
+  if (next.size() >= LEVEL_CAPACITY) {
+    compact(level + 1);
+  }
+}
+
+const FlightDataRecorderSchema::Field& FlightDataRecorderFieldStatistics::getField() const {
+  return field;
+}
+
+uint64_t FlightDataRecorderFieldStatistics::getCount() const {
+  return count;
+}
+
+double FlightDataRecorderFieldStatistics::getMinimum() const {
+  return minimum;
+}
+
+double FlightDataRecorderFieldStatistics::getMaximum() const {
+  return maximum;
+}
+
+double FlightDataRecorderFieldStatistics::getMean() const {
+  return count > 0 ? shift + sum / static_cast<double>(count) : 0;
+}
+
+double FlightDataRecorderFieldStatistics::getStandardDeviation() const {
+  if (count == 0) {
+    return 0;
+  }
+  auto mean = sum / static_cast<double>(count);
+  return sqrt(max(sumOfSquares / static_cast<double>(count) - mean * mean, 0.0));
+}
+
+double FlightDataRecorderFieldStatistics::getQuantile(double quantile) const {
+  if (constantCount > 0) {
+    return shift;
+  }
+
+  // weighted values of all levels in ascending order
+  vector<pair<double, uint64_t>> values;
+  uint64_t totalWeight = 0;
+  for (size_t level = 0; level < levels.size(); level++) {
+    for (auto value : levels[level]) {
+      values.emplace_back(value, uint64_t(1) << level);
+      totalWeight += uint64_t(1) << level;
+    }
+  }
+  if (values.empty()) {
+    return 0;
+  }
+  sort(values.begin(), values.end());
+
+  // first value whose cumulative weight reaches the quantile, the extrema are known exactly
+  if (quantile <= 0) {
+    return minimum;
+  }
+  if (quantile >= 1) {
+    return maximum;
+  }
+  auto rank = quantile * static_cast<double>(totalWeight);
+  uint64_t weight = 0;
+  for (const auto& value : values) {
+    weight += value.second;
+    if (static_cast<double>(weight) >= rank) {
+      return value.first;
+    }
+  }
+  return values.back().first;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// Summary statistics of one field, accumulated in a single pass over the samples. Count, extrema, mean and standard
+// deviation are exact (running sums relative to the first value); quantiles come from a sketch of bounded size.
+//
+// The sketch is a hierarchy of compactors: values are collected in level 0, a full level is sorted and every other
+// value is promoted to the next level with twice the weight. Memory grows with the logarithm of the number of samples.
+// Each compaction shifts ranks by at most the weight of its level, so the rank error of n samples is bounded by
+// log2(n / LEVEL_CAPACITY) / LEVEL_CAPACITY of n: about 4 % at 2^18 samples (2.4 hours at 30 Hz), 7 % at 2^26. The
+// alternating start cancels most of it, FlightDataRecorderFieldStatisticsTest measures below 1 % at 2^18 samples.
+class FlightDataRecorderFieldStatistics {
+ public:
+  // values per level of the quantile sketch before it is compacted
+  static constexpr size_t LEVEL_CAPACITY = 256;
+
+  explicit FlightDataRecorderFieldStatistics(const FlightDataRecorderSchema::Field& field);
+
+  // adds the field of a block of raw samples, NaN values are skipped
+  void add(const unsigned char* samples, size_t numberOfSamples, size_t sampleSize);
+  void add(double value);
+
+  const FlightDataRecorderSchema::Field& getField() const;
+  uint64_t getCount() const;
+  double getMinimum() const;
+  double getMaximum() const;
+  double getMean() const;
+  double getStandardDeviation() const;
+
+  // estimated value at the given quantile between 0 and 1
+  double getQuantile(double quantile) const;
+
+ private:
+  FlightDataRecorderSchema::Field field;
+  uint64_t count = 0;
+  double minimum = 0;
+  double maximum = 0;
+  double shift = 0;
+  double sum = 0;
+  double sumOfSquares = 0;
+
+  // values of the sketch by level, a value of level i stands for 2^i samples
+  std::vector<std::vector<double>> levels;
+  uint64_t numberOfCompactions = 0;
+  // leading values equal to the first one that are not yet added to the sketch
+  uint64_t constantCount = 0;
+
+  void addToSketch(double value);
+  void compact(size_t level);
+};
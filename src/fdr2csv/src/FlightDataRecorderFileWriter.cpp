@@ -0,0 +1,190 @@
+#include "FlightDataRecorderFileWriter.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "FlightDataRecorder.h"
+#include "FlightDataRecorderSchema.h"
+
+using namespace std;
+
+bool FlightDataRecorderFileWriter::open(const string& filePath, const Settings& writerSettings) {
+  settings = writerSettings;
+  settings.samplesPerBlock = max(settings.samplesPerBlock, 1u);
+  blockSampleCount = 0;
+  blockIndex.clear();
+  numberOfSamples = 0;
+  auto interfaceVersion = FlightDataRecorder::INTERFACE_VERSION;
+
+  // uncompressed legacy files are written as they are read by the memory mapping of fdr2csv
+  if (settings.formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    if (settings.compression == FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE) {
+      plainFile.open(filePath, ios::out | ios::binary | ios::trunc);
+      plainFile.write(reinterpret_cast<const char*>(&interfaceVersion), sizeof(interfaceVersion));
+      plainBytesWritten = sizeof(interfaceVersion);
+      return plainFile.good();
+    }
+    if (!compressor.open(filePath, FlightDataRecorderCompressor::Mode::STREAM, settings.level)) {
+      return false;
+    }
+    compressor.queue(&interfaceVersion, sizeof(interfaceVersion));
+    return true;
+  }
+
+  // file header and schema like the recorder writes them
+  if (!compressor.open(filePath, FlightDataRecorderCompressor::Mode::CHUNKED, settings.level)) {
+    return false;
+  }
+  FlightDataRecorderFormat::FileHeader fileHeader = {};
+  memcpy(fileHeader.magic, FlightDataRecorderFormat::MAGIC, sizeof(fileHeader.magic));
+  fileHeader.formatVersion = FlightDataRecorderFormat::FORMAT_VERSION;
+  fileHeader.sampleSize = sizeof(FlightDataRecorderSample);
+  fileHeader.interfaceVersion = interfaceVersion;
+  fileHeader.samplesPerBlock = settings.samplesPerBlock;
+  compressor.queue(&fileHeader, sizeof(fileHeader));
+
+  const auto& fields = FlightDataRecorderSchema::getFields();
+  vector<unsigned char> schemaData;
+  FlightDataRecorderSchema::serialize(fields, schemaData);
+  vector<unsigned char> schemaHeader(sizeof(FlightDataRecorderFormat::SchemaHeader));
+  FlightDataRecorderFormat::SchemaHeader header = {};
+  header.fieldCount = static_cast<uint32_t>(fields.size());
+  header.uncompressedSize = static_cast<uint32_t>(schemaData.size());
+  memcpy(schemaHeader.data(), &header, sizeof(header));
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_SCHEMA, std::move(schemaHeader), std::move(schemaData), true);
+
+  switch (settings.encoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      rowBlock.clear();
+      break;
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      sparseBlock.initialize(fields, FlightDataRecorderSparseBlock::getAlwaysChangingFields(fields), sizeof(FlightDataRecorderSample),
+                             settings.samplesPerBlock);
+      break;
+    default:
+      columnarBlock.initialize(sizeof(FlightDataRecorderSample), settings.samplesPerBlock);
+      break;
+  }
+  return true;
+}
+
+void FlightDataRecorderFileWriter::write(const FlightDataRecorderSample& sample) {
+  numberOfSamples++;
+  if (settings.formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    if (plainFile.is_open()) {
+      plainFile.write(reinterpret_cast<const char*>(&sample), sizeof(sample));
+      plainBytesWritten += sizeof(sample);
+    } else {
+      compressor.queue(&sample, sizeof(sample));
+      compressor.process(chrono::microseconds::zero());
+    }
+    return;
+  }
+
+  if (blockSampleCount == 0) {
+    blockFirstSimulationTime = sample.ap_sm.time.simulation_time;
+  }
+  blockLastSimulationTime = sample.ap_sm.time.simulation_time;
+  switch (settings.encoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS: {
+      auto bytes = reinterpret_cast<const unsigned char*>(&sample);
+      rowBlock.insert(rowBlock.end(), bytes, bytes + sizeof(sample));
+      break;
+    }
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      sparseBlock.add(&sample);
+      break;
+    default:
+      columnarBlock.add(&sample);
+      break;
+  }
+  if (++blockSampleCount >= settings.samplesPerBlock) {
+    queueBlock();
+  }
+}
+
+bool FlightDataRecorderFileWriter::close() {
+  if (plainFile.is_open()) {
+    plainFile.close();
+    return !plainFile.fail();
+  }
+  if (!compressor.isOpen()) {
+    return false;
+  }
+  if (settings.formatVersion != FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    queueBlock();
+    queueIndex();
+  }
+  compressor.close();
+  return true;
+}
+
+uint64_t FlightDataRecorderFileWriter::getBytesWritten() const {
+  return settings.formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY &&
+                 settings.compression == FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE
+             ? plainBytesWritten
+             : compressor.getBytesWritten();
+}
+
+void FlightDataRecorderFileWriter::queueBlock() {
+  if (blockSampleCount == 0) {
+    return;
+  }
+
+  vector<unsigned char> data;
+  switch (settings.encoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      data.swap(rowBlock);
+      break;
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      sparseBlock.finish(data);
+      break;
+    default:
+      columnarBlock.finish(data);
+      break;
+  }
+
+  vector<unsigned char> header(sizeof(FlightDataRecorderFormat::BlockHeader));
+  FlightDataRecorderFormat::BlockHeader blockHeader = {};
+  blockHeader.encoding = settings.encoding;
+  blockHeader.compression = settings.compression;
+  blockHeader.sampleCount = static_cast<uint32_t>(blockSampleCount);
+  blockHeader.uncompressedSize = static_cast<uint32_t>(data.size());
+  blockHeader.firstSimulationTime = blockFirstSimulationTime;
+  blockHeader.lastSimulationTime = blockLastSimulationTime;
+  memcpy(header.data(), &blockHeader, sizeof(blockHeader));
+
+  FlightDataRecorderFormat::IndexEntry indexEntry = {};
+  indexEntry.firstSampleIndex = numberOfSamples - blockSampleCount;
+  indexEntry.sampleCount = blockHeader.sampleCount;
+  indexEntry.firstSimulationTime = blockHeader.firstSimulationTime;
+  indexEntry.lastSimulationTime = blockHeader.lastSimulationTime;
+  blockIndex.push_back(indexEntry);
+
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_BLOCK, std::move(header), std::move(data),
+                        settings.compression == FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE);
+  compressor.process(chrono::microseconds::zero());
+  blockSampleCount = 0;
+}
+
+void FlightDataRecorderFileWriter::queueIndex() {
+  // offsets of the blocks are known once they are written
+  compressor.process(chrono::microseconds::zero());
+  size_t entry = 0;
+  for (const auto& location : compressor.getChunkLocations()) {
+    if (location.type == FlightDataRecorderFormat::CHUNK_TYPE_BLOCK && entry < blockIndex.size()) {
+      blockIndex[entry++].offset = location.offset;
+    }
+  }
+
+  // index and trailer, there are no recorder statistics for generated files
+  uint64_t indexOffset = compressor.getBytesWritten();
+  auto indexData = reinterpret_cast<const unsigned char*>(blockIndex.data());
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_INDEX, {},
+                        vector<unsigned char>(indexData, indexData + blockIndex.size() * sizeof(FlightDataRecorderFormat::IndexEntry)),
+                        false);
+  auto trailerData = reinterpret_cast<const unsigned char*>(&indexOffset);
+  compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_TRAILER, {}, vector<unsigned char>(trailerData, trailerData + sizeof(indexOffset)),
+                        false);
+  blockIndex.clear();
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderColumnarBlock.h"
+#include "FlightDataRecorderCompressor.h"
+#include "FlightDataRecorderFormat.h"
+#include "FlightDataRecorderSample.h"
+#include "FlightDataRecorderSparseBlock.h"
+
+// Writes samples into a file laid out like the files of the recorder, without its rotation, manifest and time
+// budget. Block based files get the schema, the blocks, the index and the trailer; legacy files are a gzip stream,
+// or the plain interface version and samples if they are not compressed.
+class FlightDataRecorderFileWriter {
+ public:
+  struct Settings {
+    uint32_t formatVersion;
+    FlightDataRecorderFormat::BlockEncoding encoding;
+    FlightDataRecorderFormat::BlockCompression compression;
+    int level;
+    uint32_t samplesPerBlock;
+  };
+
+  bool open(const std::string& filePath, const Settings& settings);
+  void write(const FlightDataRecorderSample& sample);
+  bool close();
+
+  // bytes written to the file, final after close()
+  uint64_t getBytesWritten() const;
+
+ private:
+  Settings settings = {};
+  FlightDataRecorderCompressor compressor;
+  std::ofstream plainFile;
+  uint64_t plainBytesWritten = 0;
+
+  std::vector<unsigned char> rowBlock;
+  FlightDataRecorderColumnarBlock columnarBlock;
+  FlightDataRecorderSparseBlock sparseBlock;
+  size_t blockSampleCount = 0;
+  double blockFirstSimulationTime = 0;
+  double blockLastSimulationTime = 0;
+  std::vector<FlightDataRecorderFormat::IndexEntry> blockIndex;
+  uint64_t numberOfSamples = 0;
+
+  void queueBlock();
+  void queueIndex();
+};
@@ -0,0 +1,131 @@
+#include "FlightDataRecorderInputBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using namespace std;
+
+FlightDataRecorderInputBuffer::FlightDataRecorderInputBuffer() : input(BUFFER_SIZE), buffer(BUFFER_SIZE) {
+  setg(buffer.data(), buffer.data(), buffer.data());
+}
+
+FlightDataRecorderInputBuffer::~FlightDataRecorderInputBuffer() {
+  if (isStreamInitialized) {
+    inflateEnd(&stream);
+  }
+  if (file != nullptr && !isStdin) {
+    fclose(file);
+  }
+}
+
+bool FlightDataRecorderInputBuffer::open(const string& filePath) {
+  isStdin = filePath == "-";
+  if (isStdin) {
+#ifdef _WIN32
+    _setmode(_fileno(stdin), _O_BINARY);
+#endif
+    file = stdin;
+  } else {
+    file = fopen(filePath.c_str(), "rb");
+  }
+  if (file == nullptr) {
+    return false;
+  }
+
+  // detect gzip by its magic, anything else is passed through
+  if (!fillInput()) {
+    return true;
+  }
+  isGzip = stream.avail_in >= 2 && stream.next_in[0] == 0x1f && stream.next_in[1] == 0x8b;
+  if (isGzip) {
+    isStreamInitialized = inflateInit2(&stream, 15 + 16) == Z_OK;
+    return isStreamInitialized;
+  }
+  return true;
+}
+
+uint64_t FlightDataRecorderInputBuffer::getBytesRead() const {
+  // data read from the file but not used yet is not counted
+  return bytesRead - stream.avail_in;
+}
+
+bool FlightDataRecorderInputBuffer::fillInput() {
+  auto size = fread(input.data(), 1, input.size(), file);
+  bytesRead += size;
+  stream.next_in = input.data();
+  stream.avail_in = static_cast<uInt>(size);
+  return size > 0;
+}
+
+size_t FlightDataRecorderInputBuffer::readPlain() {
+  if (stream.avail_in == 0 && !fillInput()) {
+    return 0;
+  }
+  auto size = min<size_t>(stream.avail_in, buffer.size());
+  memcpy(buffer.data(), stream.next_in, size);
+  stream.next_in += size;
+  stream.avail_in -= static_cast<uInt>(size);
+  return size;
+}
+
+size_t FlightDataRecorderInputBuffer::readGzip() {
+  stream.next_out = reinterpret_cast<Bytef*>(buffer.data());
+  stream.avail_out = static_cast<uInt>(buffer.size());
+  while (stream.avail_out > 0) {
+    if (stream.avail_in == 0 && !fillInput()) {
+      break;
+    }
+    auto result = inflate(&stream, Z_NO_FLUSH);
+    if (result == Z_STREAM_END) {
+      // several gzip members may follow each other
+      inflateReset(&stream);
+    } else if (result != Z_OK && result != Z_BUF_ERROR) {
+      break;
+    }
+  }
+  return buffer.size() - stream.avail_out;
+}
+
+FlightDataRecorderInputBuffer::int_type FlightDataRecorderInputBuffer::underflow() {
+  if (gptr() < egptr()) {
+    return traits_type::to_int_type(*gptr());
+  }
+
+  bufferPosition += egptr() - eback();
+  auto size = isGzip ? readGzip() : readPlain();
+  setg(buffer.data(), buffer.data(), buffer.data() + size);
+  return size > 0 ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+FlightDataRecorderInputBuffer::pos_type FlightDataRecorderInputBuffer::seekoff(off_type offset,
+                                                                               ios_base::seekdir direction,
+                                                                               ios_base::openmode mode) {
+  // the end of a pipe is unknown
+  if (direction == ios_base::end) {
+    return pos_type(off_type(-1));
+  }
+  auto position = static_cast<off_type>(direction == ios_base::cur ? bufferPosition + (gptr() - eback()) : 0) + offset;
+  return seekpos(pos_type(position), mode);
+}
+
+FlightDataRecorderInputBuffer::pos_type FlightDataRecorderInputBuffer::seekpos(pos_type position, ios_base::openmode) {
+  auto target = static_cast<uint64_t>(static_cast<off_type>(position));
+  if (static_cast<off_type>(position) < 0 || target < bufferPosition) {
+    return pos_type(off_type(-1));
+  }
+
+  // positions after the buffer are reached by reading over the data in between
+  while (target > bufferPosition + (egptr() - eback())) {
+    setg(eback(), egptr(), egptr());
+    if (traits_type::eq_int_type(underflow(), traits_type::eof())) {
+      return pos_type(off_type(-1));
+    }
+  }
+  setg(eback(), eback() + (target - bufferPosition), egptr());
+  return position;
+}
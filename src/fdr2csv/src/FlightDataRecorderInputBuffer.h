@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "zlib.h"
+
+// Stream buffer reading gzip compressed or plain data with large buffers, the format is detected by the gzip magic.
+// It also reads from stdin, so files can be converted within a pipe. Pipes cannot seek, therefore only positions
+// within the current buffer and positions after it can be reached.
+class FlightDataRecorderInputBuffer : public std::streambuf {
+ public:
+  FlightDataRecorderInputBuffer();
+  ~FlightDataRecorderInputBuffer() override;
+
+  // opens the file, "-" is stdin
+  bool open(const std::string& filePath);
+
+  // bytes consumed from the file, i.e. compressed bytes for gzip input
+  uint64_t getBytesRead() const;
+
+ protected:
+  int_type underflow() override;
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override;
+  pos_type seekpos(pos_type position, std::ios_base::openmode mode) override;
+
+ private:
+  static constexpr size_t BUFFER_SIZE = 4 * 1024 * 1024;
+
+  FILE* file = nullptr;
+  bool isStdin = false;
+  bool isGzip = false;
+  bool isStreamInitialized = false;
+  z_stream stream = {};
+
+  // data as read from the file and decompressed data
+  std::vector<unsigned char> input;
+  std::vector<char> buffer;
+  uint64_t bytesRead = 0;
+  // stream position of the start of the buffer
+  uint64_t bufferPosition = 0;
+
+  bool fillInput();
+  size_t readPlain();
+  size_t readGzip();
+};
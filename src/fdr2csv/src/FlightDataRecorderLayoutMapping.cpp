@@ -0,0 +1,70 @@
+#include "FlightDataRecorderLayoutMapping.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+
+FlightDataRecorderLayoutMapping::FlightDataRecorderLayoutMapping(const vector<FlightDataRecorderSchema::Field>& sourceFields,
+                                                                 uint32_t mappingSourceSampleSize,
+                                                                 const vector<FlightDataRecorderSchema::Field>& targetFields,
+                                                                 uint32_t mappingTargetSampleSize)
+    : sourceSampleSize(mappingSourceSampleSize), targetSampleSize(mappingTargetSampleSize) {
+  for (const auto& field : targetFields) {
+    auto sourceField = FlightDataRecorderSchema::find(sourceFields, field.path);
+    if (sourceField == nullptr) {
+      numberOfMissingFields++;
+    } else if (sourceField->type == field.type && sourceField->size == field.size) {
+      copies.push_back({sourceField->offset, field.offset, field.size});
+    } else {
+      conversions.push_back({*sourceField, field});
+    }
+  }
+  for (const auto& field : sourceFields) {
+    if (FlightDataRecorderSchema::find(targetFields, field.path) == nullptr) {
+      numberOfDroppedFields++;
+    }
+  }
+
+  // fields that keep their relative position are copied at once
+  sort(copies.begin(), copies.end(), [](const Copy& a, const Copy& b) { return a.targetOffset < b.targetOffset; });
+  vector<Copy> mergedCopies;
+  for (const auto& copy : copies) {
+    if (!mergedCopies.empty()) {
+      auto& last = mergedCopies.back();
+      if (last.sourceOffset + last.size == copy.sourceOffset && last.targetOffset + last.size == copy.targetOffset) {
+        last.size += copy.size;
+        continue;
+      }
+    }
+    mergedCopies.push_back(copy);
+  }
+  copies.swap(mergedCopies);
+}
+
+uint32_t FlightDataRecorderLayoutMapping::getTargetSampleSize() const {
+  return targetSampleSize;
+}
+
+size_t FlightDataRecorderLayoutMapping::getNumberOfMissingFields() const {
+  return numberOfMissingFields;
+}
+
+size_t FlightDataRecorderLayoutMapping::getNumberOfDroppedFields() const {
+  return numberOfDroppedFields;
+}
+
+void FlightDataRecorderLayoutMapping::map(const unsigned char* samples, size_t numberOfSamples, vector<unsigned char>& buffer) const {
+  // missing fields and padding stay zero
+  buffer.assign(numberOfSamples * targetSampleSize, 0);
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    auto source = samples + i * sourceSampleSize;
+    auto target = buffer.data() + i * targetSampleSize;
+    for (const auto& copy : copies) {
+      memcpy(target + copy.targetOffset, source + copy.sourceOffset, copy.size);
+    }
+    for (const auto& conversion : conversions) {
+      FlightDataRecorderSchema::setValue(conversion.target, target, FlightDataRecorderSchema::getValue(conversion.source, source));
+    }
+  }
+}
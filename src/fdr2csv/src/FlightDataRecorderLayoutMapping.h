@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// Maps raw samples of one layout onto another by field path, e.g. samples of an older interface version onto the
+// compiled FlightDataRecorderSample. Fields missing in the source are zero, fields missing in the target are dropped
+// and fields whose type changed are converted through double. Fields with the same type are copied as byte ranges,
+// neighbouring ranges are merged into a single copy.
+class FlightDataRecorderLayoutMapping {
+ public:
+  FlightDataRecorderLayoutMapping(const std::vector<FlightDataRecorderSchema::Field>& sourceFields,
+                                  uint32_t sourceSampleSize,
+                                  const std::vector<FlightDataRecorderSchema::Field>& targetFields,
+                                  uint32_t targetSampleSize);
+
+  uint32_t getTargetSampleSize() const;
+
+  // fields of the target that are zero and fields of the source that are dropped
+  size_t getNumberOfMissingFields() const;
+  size_t getNumberOfDroppedFields() const;
+
+  // maps consecutive samples into the buffer, which is resized to hold them
+  void map(const unsigned char* samples, size_t numberOfSamples, std::vector<unsigned char>& buffer) const;
+
+ private:
+  struct Copy {
+    uint32_t sourceOffset;
+    uint32_t targetOffset;
+    uint32_t size;
+  };
+
+  struct Conversion {
+    FlightDataRecorderSchema::Field source;
+    FlightDataRecorderSchema::Field target;
+  };
+
+  uint32_t sourceSampleSize;
+  uint32_t targetSampleSize;
+  std::vector<Copy> copies;
+  std::vector<Conversion> conversions;
+  size_t numberOfMissingFields = 0;
+  size_t numberOfDroppedFields = 0;
+};
@@ -0,0 +1,25 @@
+#include "FlightDataRecorderLayouts.h"
+
+#include <algorithm>
+
+#include "FlightDataRecorder.h"
+
+using namespace std;
+
+const vector<FlightDataRecorderLayouts::Layout>& FlightDataRecorderLayouts::getLayouts() {
+  // layouts of past interface versions are inserted in front of the current one
+  static const vector<Layout> layouts = {
+      {FlightDataRecorder::INTERFACE_VERSION, sizeof(FlightDataRecorderSample), FlightDataRecorderSchema::getFields()},
+  };
+  return layouts;
+}
+
+const FlightDataRecorderLayouts::Layout* FlightDataRecorderLayouts::find(uint64_t interfaceVersion) {
+  const auto& layouts = getLayouts();
+  auto position = lower_bound(layouts.begin(), layouts.end(), interfaceVersion,
+                              [](const Layout& layout, uint64_t version) { return layout.interfaceVersion < version; });
+  if (position == layouts.end() || position->interfaceVersion != interfaceVersion) {
+    return nullptr;
+  }
+  return &*position;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "FlightDataRecorderSchema.h"
+
+// Sample layouts of the interface versions known to the reader, used for files that carry no schema chunk (legacy
+// files and block based files written before the schema chunk was introduced). The layout of such a file is picked
+// by the interface version in its header.
+//
+// The current version uses the field table generated from FlightDataRecorderSample. The structs of past versions are
+// no longer compiled, so their layouts are added as literal field tables (path, type, offset and size, as written
+// into the schema chunk) generated from the *_types.h headers of the release that recorded them.
+class FlightDataRecorderLayouts {
+ public:
+  FlightDataRecorderLayouts() = delete;
+  ~FlightDataRecorderLayouts() = delete;
+
+  struct Layout {
+    uint64_t interfaceVersion;
+    uint32_t sampleSize;
+    std::vector<FlightDataRecorderSchema::Field> fields;
+  };
+
+  // all known layouts ordered by interface version
+  static const std::vector<Layout>& getLayouts();
+
+  // returns the layout of the interface version or nullptr if it is unknown
+  static const Layout* find(uint64_t interfaceVersion);
+};
@@ -0,0 +1,107 @@
+#include "FlightDataRecorderMappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+FlightDataRecorderMappedFile::~FlightDataRecorderMappedFile() {
+  close();
+}
+
+#ifdef _WIN32
+
+bool FlightDataRecorderMappedFile::open(const string& filePath) {
+  close();
+  fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                           FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if (fileHandle == INVALID_HANDLE_VALUE) {
+    fileHandle = nullptr;
+    return false;
+  }
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+    close();
+    return false;
+  }
+  mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mappingHandle == nullptr) {
+    close();
+    return false;
+  }
+  data = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+  if (data == nullptr) {
+    close();
+    return false;
+  }
+  size = static_cast<size_t>(fileSize.QuadPart);
+  return true;
+}
+
+void FlightDataRecorderMappedFile::close() {
+  if (data != nullptr) {
+    UnmapViewOfFile(data);
+  }
+  if (mappingHandle != nullptr) {
+    CloseHandle(mappingHandle);
+  }
+  if (fileHandle != nullptr) {
+    CloseHandle(fileHandle);
+  }
+  data = nullptr;
+  size = 0;
+  mappingHandle = nullptr;
+  fileHandle = nullptr;
+}
+
+#else
+
+bool FlightDataRecorderMappedFile::open(const string& filePath) {
+  close();
+  auto file = ::open(filePath.c_str(), O_RDONLY);
+  if (file < 0) {
+    return false;
+  }
+  struct stat status = {};
+  if (fstat(file, &status) != 0 || status.st_size == 0) {
+    ::close(file);
+    return false;
+  }
+
+  // the mapping stays valid after the file is closed
+  auto mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+  ::close(file);
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+  // samples are read front to back
+  madvise(mapping, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+  data = static_cast<const unsigned char*>(mapping);
+  size = static_cast<size_t>(status.st_size);
+  return true;
+}
+
+void FlightDataRecorderMappedFile::close() {
+  if (data != nullptr) {
+    munmap(const_cast<unsigned char*>(data), size);
+  }
+  data = nullptr;
+  size = 0;
+}
+
+#endif
+
+const unsigned char* FlightDataRecorderMappedFile::getData() const {
+  return data;
+}
+
+size_t FlightDataRecorderMappedFile::getSize() const {
+  return size;
+}
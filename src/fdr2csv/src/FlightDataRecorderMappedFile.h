@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file. Uncompressed files are read in place through the mapping, which avoids
+// copying every sample through a stream and allows random access to samples.
+class FlightDataRecorderMappedFile {
+ public:
+  FlightDataRecorderMappedFile() = default;
+  FlightDataRecorderMappedFile(const FlightDataRecorderMappedFile&) = delete;
+  FlightDataRecorderMappedFile& operator=(const FlightDataRecorderMappedFile&) = delete;
+  ~FlightDataRecorderMappedFile();
+
+  // maps the file, returns false if it cannot be mapped, e.g. because it is empty
+  bool open(const std::string& filePath);
+  void close();
+
+  const unsigned char* getData() const;
+  size_t getSize() const;
+
+ private:
+  const unsigned char* data = nullptr;
+  size_t size = 0;
+#ifdef _WIN32
+  void* fileHandle = nullptr;
+  void* mappingHandle = nullptr;
+#endif
+};
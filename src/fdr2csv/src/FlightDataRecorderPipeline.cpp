@@ -0,0 +1,135 @@
+#include "FlightDataRecorderPipeline.h"
+
+#include <algorithm>
+
+using namespace std;
+
+FlightDataRecorderPipeline::FlightDataRecorderPipeline(FlightDataRecorderReader& reader, size_t numberOfWorkers)
+    : reader(reader), numberOfWorkers(max<size_t>(numberOfWorkers, 1)) {}
+
+FlightDataRecorderPipeline::~FlightDataRecorderPipeline() {
+  stop();
+}
+
+bool FlightDataRecorderPipeline::run(const BlockFormatter& blockFormatter, const BlockWriter& writer, const Progress& progress) {
+  error.clear();
+  formatter = &blockFormatter;
+  isStopping = false;
+  for (size_t i = 0; i < numberOfWorkers; i++) {
+    workers.emplace_back(&FlightDataRecorderPipeline::work, this);
+  }
+
+  // blocks in flight in the order of the file, only used by this thread
+  deque<shared_ptr<Job>> jobs;
+  auto maximumNumberOfJobs = 2 * numberOfWorkers;
+  auto isEndOfFile = false;
+  uint64_t numberOfSamples = 0;
+
+  while (true) {
+    // read blocks until the pipeline is full
+    while (!isEndOfFile && jobs.size() < maximumNumberOfJobs) {
+      auto job = make_shared<Job>();
+      if (!reader.readChunk(job->chunk, LEGACY_SAMPLES_PER_BLOCK)) {
+        isEndOfFile = true;
+        break;
+      }
+      jobs.push_back(job);
+      {
+        lock_guard<std::mutex> lock(mutex);
+        pending.push_back(job);
+      }
+      pendingCondition.notify_one();
+    }
+    if (jobs.empty()) {
+      break;
+    }
+
+    // wait for the oldest block
+    auto job = jobs.front();
+    jobs.pop_front();
+    {
+      unique_lock<std::mutex> lock(mutex);
+      doneCondition.wait(lock, [&job] { return job->isDone; });
+    }
+    if (!job->isOk) {
+      error = job->error;
+      break;
+    }
+
+    // write block
+    if (!writer(job->text, job->numberOfSamples)) {
+      error = "Failed to write output!";
+      break;
+    }
+    numberOfSamples += job->numberOfSamples;
+    if (progress) {
+      progress(numberOfSamples);
+    }
+  }
+
+  stop();
+
+  // errors of the reader are reported after all blocks in front of them were written
+  if (error.empty()) {
+    error = reader.getError();
+  }
+  return error.empty();
+}
+
+const string& FlightDataRecorderPipeline::getError() const {
+  return error;
+}
+
+void FlightDataRecorderPipeline::work() {
+  vector<unsigned char> samples;
+  string text;
+
+  while (true) {
+    shared_ptr<Job> job;
+    {
+      unique_lock<std::mutex> lock(mutex);
+      pendingCondition.wait(lock, [this] { return isStopping || !pending.empty(); });
+      if (isStopping) {
+        return;
+      }
+      job = pending.front();
+      pending.pop_front();
+    }
+
+    // decode and format the whole block
+    string jobError;
+    const unsigned char* data = nullptr;
+    size_t numberOfSamples = 0;
+    auto isOk = reader.decodeChunk(job->chunk, samples, data, numberOfSamples, jobError);
+    if (isOk) {
+      text.clear();
+      (*formatter)(text, data, numberOfSamples);
+    }
+
+    {
+      lock_guard<std::mutex> lock(mutex);
+      if (isOk) {
+        job->text.swap(text);
+      }
+      job->error = jobError;
+      job->numberOfSamples = numberOfSamples;
+      job->isOk = isOk;
+      job->isDone = true;
+      vector<unsigned char>().swap(job->chunk.payload);
+    }
+    doneCondition.notify_all();
+  }
+}
+
+void FlightDataRecorderPipeline::stop() {
+  {
+    lock_guard<std::mutex> lock(mutex);
+    isStopping = true;
+    pending.clear();
+  }
+  pendingCondition.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  workers.clear();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "FlightDataRecorderReader.h"
+
+// Converts the samples of a file using several threads. The reader reads the blocks of the file on the calling thread,
+// a pool of workers decodes and formats whole blocks in parallel and the calling thread writes the formatted blocks
+// in the order of the file. The output is identical to formatting one sample after the other.
+//
+// The number of blocks in flight is limited to twice the number of workers, so memory usage does not depend on the
+// size of the file.
+class FlightDataRecorderPipeline {
+ public:
+  // appends a whole block of raw samples in any output format to the buffer
+  using BlockFormatter = std::function<void(std::string& buffer, const unsigned char* samples, size_t numberOfSamples)>;
+
+  // writes a formatted block, blocks are passed in the order of the file; returns false if the output failed
+  using BlockWriter = std::function<bool(const std::string& buffer, size_t numberOfSamples)>;
+
+  // called after a block was written with the total number of samples written
+  using Progress = std::function<void(uint64_t numberOfSamples)>;
+
+  FlightDataRecorderPipeline(FlightDataRecorderReader& reader, size_t numberOfWorkers);
+  ~FlightDataRecorderPipeline();
+
+  // returns false if the file is corrupt or the output failed, all samples in front of the error are written
+  bool run(const BlockFormatter& formatter, const BlockWriter& writer, const Progress& progress);
+
+  const std::string& getError() const;
+
+ private:
+  // samples of legacy files per block
+  static constexpr size_t LEGACY_SAMPLES_PER_BLOCK = 1024;
+
+  struct Job {
+    FlightDataRecorderReader::Chunk chunk;
+    std::string text;
+    size_t numberOfSamples = 0;
+    std::string error;
+    bool isDone = false;
+    bool isOk = false;
+  };
+
+  FlightDataRecorderReader& reader;
+  size_t numberOfWorkers;
+  std::string error;
+
+  const BlockFormatter* formatter = nullptr;
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable pendingCondition;
+  std::condition_variable doneCondition;
+  std::deque<std::shared_ptr<Job>> pending;
+  bool isStopping = false;
+
+  void work();
+  void stop();
+};
@@ -0,0 +1,725 @@
+#include "FlightDataRecorderReader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+
+#include "FlightDataRecorderColumnarBlock.h"
+#include "FlightDataRecorderLayouts.h"
+#include "FlightDataRecorderSparseBlock.h"
+#include "zlib.h"
+
+using namespace std;
+
+bool FlightDataRecorderReader::open(const string& filePath, bool isCompressed) {
+  // uncompressed legacy files are mapped and their samples are used in place
+  auto isStream = filePath == "-";
+  if (!isCompressed && !isStream) {
+    mappedFile = make_unique<FlightDataRecorderMappedFile>();
+    if (mappedFile->open(filePath) && mappedFile->getSize() >= sizeof(interfaceVersion) &&
+        memcmp(mappedFile->getData(), FlightDataRecorderFormat::MAGIC, sizeof(FlightDataRecorderFormat::MAGIC)) != 0) {
+      formatVersion = FlightDataRecorderFormat::FORMAT_VERSION_LEGACY;
+      memcpy(&interfaceVersion, mappedFile->getData(), sizeof(interfaceVersion));
+      fileSize = mappedFile->getSize();
+      useRegisteredLayout();
+      simulationTimeField = FlightDataRecorderSchema::find(schema, "ap_sm.time.simulation_time");
+      return true;
+    }
+    mappedFile.reset();
+  }
+
+  // create input stream, gzip input and stdin are read through zlib
+  if (isCompressed || isStream) {
+    inBuffer = make_unique<FlightDataRecorderInputBuffer>();
+    if (!inBuffer->open(filePath)) {
+      error = "Failed to open input file!";
+      return false;
+    }
+    in = make_unique<istream>(inBuffer.get());
+  } else {
+    in = make_unique<ifstream>(filePath.c_str(), ios::in | ios::binary);
+  }
+  error_code errorCode;
+  fileSize = isStream ? 0 : filesystem::file_size(filePath, errorCode);
+
+  // check if stream is ok
+  if (!in->good()) {
+    error = "Failed to open input file!";
+    return false;
+  }
+
+  // read magic or interface version of legacy files
+  char start[sizeof(FlightDataRecorderFormat::MAGIC)] = {};
+  in->read(start, sizeof(start));
+  if (in->gcount() != sizeof(start)) {
+    error = "Failed to read file header!";
+    return false;
+  }
+
+  if (memcmp(start, FlightDataRecorderFormat::MAGIC, sizeof(start)) != 0) {
+    // legacy file -> samples follow directly
+    formatVersion = FlightDataRecorderFormat::FORMAT_VERSION_LEGACY;
+    memcpy(&interfaceVersion, start, sizeof(interfaceVersion));
+    useRegisteredLayout();
+    simulationTimeField = FlightDataRecorderSchema::find(schema, "ap_sm.time.simulation_time");
+    return true;
+  }
+
+  // block based files are never gzip wrapped -> reopen files as plain file to allow seeking and read header
+  memcpy(&fileHeader, start, sizeof(start));
+  if (!isStream) {
+    in = make_unique<ifstream>(filePath.c_str(), ios::in | ios::binary);
+    inBuffer.reset();
+    in->seekg(sizeof(start));
+  }
+  in->read(reinterpret_cast<char*>(&fileHeader) + sizeof(start), sizeof(fileHeader) - sizeof(start));
+  if (in->gcount() != sizeof(fileHeader) - sizeof(start)) {
+    error = "Failed to read file header!";
+    return false;
+  }
+  formatVersion = fileHeader.formatVersion;
+  interfaceVersion = fileHeader.interfaceVersion;
+
+  // check if file can be decoded
+  if (formatVersion != FlightDataRecorderFormat::FORMAT_VERSION) {
+    error = "Unsupported file format version " + to_string(formatVersion) + "!";
+    return false;
+  }
+  sampleSize = fileHeader.sampleSize;
+
+  // read schema, files written before the schema chunk was introduced use the layout of their interface version
+  if (!readSchemaChunk()) {
+    if (!error.empty()) {
+      return false;
+    }
+    auto fileSampleSize = sampleSize;
+    useRegisteredLayout();
+    if (fileSampleSize != sampleSize) {
+      error = "Sample size of file (" + to_string(fileSampleSize) + ") does not match layout (" + to_string(sampleSize) +
+              ") and file contains no schema!";
+      return false;
+    }
+  }
+
+  // the simulation time is needed to seek by time
+  simulationTimeField = FlightDataRecorderSchema::find(schema, "ap_sm.time.simulation_time");
+  if (simulationTimeField != nullptr && simulationTimeField->type != FlightDataRecorderSchema::FIELD_TYPE_REAL) {
+    simulationTimeField = nullptr;
+  }
+
+  return true;
+}
+
+bool FlightDataRecorderReader::useRegisteredLayout() {
+  // unknown versions fall back to the compiled layout, the samples can then only be decoded if it did not change
+  auto layout = FlightDataRecorderLayouts::find(interfaceVersion);
+  if (layout == nullptr) {
+    sampleSize = sizeof(FlightDataRecorderSample);
+    schema = FlightDataRecorderSchema::getFields();
+    return false;
+  }
+  sampleSize = layout->sampleSize;
+  schema = layout->fields;
+  isRegisteredLayout = true;
+  return true;
+}
+
+bool FlightDataRecorderReader::readSchemaChunk() {
+  // the schema chunk directly follows the file header
+  auto position = in->tellg();
+  FlightDataRecorderFormat::ChunkHeader chunkHeader = {};
+  in->read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader));
+  if (in->gcount() != sizeof(chunkHeader) || chunkHeader.type != FlightDataRecorderFormat::CHUNK_TYPE_SCHEMA ||
+      chunkHeader.size < sizeof(FlightDataRecorderFormat::SchemaHeader)) {
+    // no schema -> continue reading behind file header
+    in->clear();
+    in->seekg(position);
+    return false;
+  }
+
+  // read and inflate field list
+  compressedBlock.resize(chunkHeader.size);
+  in->read(reinterpret_cast<char*>(compressedBlock.data()), chunkHeader.size);
+  if (static_cast<uint32_t>(in->gcount()) != chunkHeader.size) {
+    error = "Unexpected end of file within schema!";
+    return false;
+  }
+  FlightDataRecorderFormat::SchemaHeader schemaHeader = {};
+  memcpy(&schemaHeader, compressedBlock.data(), sizeof(schemaHeader));
+  encodedBlock.resize(schemaHeader.uncompressedSize);
+  if (!inflateBlock(compressedBlock.data() + sizeof(schemaHeader), chunkHeader.size - sizeof(schemaHeader), encodedBlock) ||
+      !FlightDataRecorderSchema::deserialize(encodedBlock.data(), encodedBlock.size(), schema) || schema.size() != schemaHeader.fieldCount) {
+    error = "Failed to decode schema!";
+    return false;
+  }
+
+  // check that all fields are within the sample
+  for (const auto& field : schema) {
+    if (field.offset + field.size > sampleSize) {
+      error = "Field '" + field.path + "' of schema exceeds sample size!";
+      return false;
+    }
+  }
+
+  isFileSchema = true;
+  return true;
+}
+
+uint32_t FlightDataRecorderReader::getFormatVersion() const {
+  return formatVersion;
+}
+
+uint64_t FlightDataRecorderReader::getInterfaceVersion() const {
+  return interfaceVersion;
+}
+
+uint32_t FlightDataRecorderReader::getSampleSize() const {
+  return sampleSize;
+}
+
+const vector<FlightDataRecorderSchema::Field>& FlightDataRecorderReader::getSchema() const {
+  return schema;
+}
+
+bool FlightDataRecorderReader::hasFileSchema() const {
+  return isFileSchema;
+}
+
+bool FlightDataRecorderReader::hasLayout() const {
+  return isFileSchema || isRegisteredLayout;
+}
+
+const string& FlightDataRecorderReader::getError() const {
+  return error;
+}
+
+bool FlightDataRecorderReader::read(FlightDataRecorderSample& sample) {
+  if (sampleSize != sizeof(sample)) {
+    error = "Sample layout of file does not match converter!";
+    return false;
+  }
+
+  auto data = readRaw();
+  if (data == nullptr) {
+    return false;
+  }
+  memcpy(&sample, data, sizeof(sample));
+  return true;
+}
+
+const unsigned char* FlightDataRecorderReader::readRaw() {
+  // get next block if current one is consumed
+  while (blockSampleIndex >= blockSampleCount) {
+    if (!readBlock()) {
+      return nullptr;
+    }
+  }
+
+  return blockSamples + sampleSize * blockSampleIndex++;
+}
+
+uint64_t FlightDataRecorderReader::getBytesRead() const {
+  if (mappedFile != nullptr) {
+    return min<uint64_t>(sizeof(interfaceVersion) + nextSampleIndex * sampleSize, fileSize);
+  }
+  if (inBuffer != nullptr) {
+    return inBuffer->getBytesRead();
+  }
+  // the position is lost at the end of the file
+  auto position = in->tellg();
+  return position >= 0 ? static_cast<uint64_t>(position) : fileSize;
+}
+
+const vector<FlightDataRecorderFormat::IndexEntry>& FlightDataRecorderReader::getIndex() {
+  // streams cannot be searched for the index
+  if (isIndexLoaded || formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY || inBuffer != nullptr) {
+    return index;
+  }
+
+  // remember position to continue reading afterwards
+  auto position = in->tellg();
+
+  // prefer index chunk, fall back to scanning the file
+  if (!readIndexChunk()) {
+    scanBlockHeaders();
+  }
+  isIndexLoaded = true;
+
+  // restore position
+  in->clear();
+  in->seekg(position);
+
+  return index;
+}
+
+bool FlightDataRecorderReader::getStatistics(FlightDataRecorderFormat::Statistics& result) {
+  // statistics are read together with the index
+  getIndex();
+  if (hasStatistics) {
+    result = statistics;
+  }
+  return hasStatistics;
+}
+
+bool FlightDataRecorderReader::seekToSimulationTime(double simulationTime) {
+  // samples of mapped files are searched in place
+  if (mappedFile != nullptr) {
+    auto sampleIndex = findMappedSample(simulationTime);
+    return sampleIndex < getNumberOfMappedSamples() && seekToSample(sampleIndex);
+  }
+
+  auto& entries = getIndex();
+
+  // find first block that ends at or after the requested time
+  for (size_t entry = 0; entry < entries.size(); entry++) {
+    if (entries[entry].lastSimulationTime >= simulationTime) {
+      if (!seekToBlock(entry)) {
+        return false;
+      }
+      // skip samples of the block before the requested time
+      while (blockSampleIndex < blockSampleCount &&
+             getSimulationTime(blockSamples + sampleSize * blockSampleIndex) < simulationTime) {
+        blockSampleIndex++;
+      }
+      return true;
+    }
+  }
+
+  // requested time is after the end of the file
+  return false;
+}
+
+bool FlightDataRecorderReader::seekToSample(uint64_t sampleIndex) {
+  // samples of mapped files are addressed directly
+  if (mappedFile != nullptr) {
+    if (sampleIndex >= getNumberOfMappedSamples()) {
+      return false;
+    }
+    nextSampleIndex = sampleIndex;
+    isWindowPassed = false;
+    blockSampleCount = 0;
+    blockSampleIndex = 0;
+    return true;
+  }
+
+  auto& entries = getIndex();
+
+  // find block containing the requested sample
+  for (size_t entry = 0; entry < entries.size(); entry++) {
+    if (sampleIndex < entries[entry].firstSampleIndex + entries[entry].sampleCount) {
+      if (!seekToBlock(entry)) {
+        return false;
+      }
+      blockSampleIndex = static_cast<size_t>(sampleIndex - entries[entry].firstSampleIndex);
+      return true;
+    }
+  }
+
+  // requested sample is after the end of the file
+  return false;
+}
+
+bool FlightDataRecorderReader::seekToBlock(size_t entry) {
+  in->clear();
+  in->seekg(static_cast<streamoff>(index[entry].offset));
+  nextSampleIndex = index[entry].firstSampleIndex;
+  isWindowPassed = false;
+  blockSampleCount = 0;
+  blockSampleIndex = 0;
+  return readBlock();
+}
+
+bool FlightDataRecorderReader::readIndexChunk() {
+  // read trailer at the end of the file
+  FlightDataRecorderFormat::Trailer trailer = {};
+  in->clear();
+  in->seekg(-static_cast<streamoff>(sizeof(trailer)), ios::end);
+  in->read(reinterpret_cast<char*>(&trailer), sizeof(trailer));
+  if (in->gcount() != sizeof(trailer) || trailer.header.type != FlightDataRecorderFormat::CHUNK_TYPE_TRAILER ||
+      trailer.header.size != sizeof(trailer.indexOffset)) {
+    return false;
+  }
+
+  // read index chunk
+  FlightDataRecorderFormat::ChunkHeader chunkHeader = {};
+  in->seekg(static_cast<streamoff>(trailer.indexOffset));
+  in->read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader));
+  if (in->gcount() != sizeof(chunkHeader) || chunkHeader.type != FlightDataRecorderFormat::CHUNK_TYPE_INDEX ||
+      chunkHeader.size % sizeof(FlightDataRecorderFormat::IndexEntry) != 0) {
+    return false;
+  }
+  index.resize(chunkHeader.size / sizeof(FlightDataRecorderFormat::IndexEntry));
+  in->read(reinterpret_cast<char*>(index.data()), chunkHeader.size);
+  if (static_cast<uint32_t>(in->gcount()) != chunkHeader.size) {
+    index.clear();
+    return false;
+  }
+
+  // statistics chunk follows the index
+  in->read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader));
+  if (in->gcount() == sizeof(chunkHeader) && chunkHeader.type == FlightDataRecorderFormat::CHUNK_TYPE_STATISTICS &&
+      chunkHeader.size == sizeof(statistics)) {
+    in->read(reinterpret_cast<char*>(&statistics), sizeof(statistics));
+    hasStatistics = in->gcount() == sizeof(statistics);
+  }
+
+  return true;
+}
+
+void FlightDataRecorderReader::scanBlockHeaders() {
+  index.clear();
+  uint64_t sampleCounter = 0;
+
+  // get file size to detect a truncated last chunk
+  in->clear();
+  in->seekg(0, ios::end);
+  auto fileSize = static_cast<uint64_t>(in->tellg());
+
+  // walk over all chunks starting after the file header, only block headers are read
+  in->seekg(sizeof(FlightDataRecorderFormat::FileHeader));
+  while (true) {
+    uint64_t offset = static_cast<uint64_t>(in->tellg());
+    FlightDataRecorderFormat::ChunkHeader chunkHeader = {};
+    in->read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader));
+    if (in->gcount() != sizeof(chunkHeader) || offset + sizeof(chunkHeader) + chunkHeader.size > fileSize) {
+      break;
+    }
+
+    if (chunkHeader.type == FlightDataRecorderFormat::CHUNK_TYPE_BLOCK && chunkHeader.size >= sizeof(FlightDataRecorderFormat::BlockHeader)) {
+      FlightDataRecorderFormat::BlockHeader blockHeader = {};
+      in->read(reinterpret_cast<char*>(&blockHeader), sizeof(blockHeader));
+      if (in->gcount() != sizeof(blockHeader)) {
+        break;
+      }
+      index.push_back({offset, sampleCounter, blockHeader.sampleCount, 0, blockHeader.firstSimulationTime, blockHeader.lastSimulationTime});
+      sampleCounter += blockHeader.sampleCount;
+      in->seekg(static_cast<streamoff>(chunkHeader.size - sizeof(blockHeader)), ios::cur);
+    } else {
+      in->seekg(static_cast<streamoff>(chunkHeader.size), ios::cur);
+    }
+  }
+}
+
+void FlightDataRecorderReader::setSimulationTimeWindow(double from, double to) {
+  windowFromTime = from;
+  windowToTime = to;
+  seekToWindow();
+}
+
+void FlightDataRecorderReader::setSampleWindow(uint64_t from, uint64_t to) {
+  windowFromSample = from;
+  windowToSample = to;
+  seekToWindow();
+}
+
+void FlightDataRecorderReader::seekToWindow() {
+  // jump to the first sample of mapped files within the window
+  if (mappedFile != nullptr) {
+    nextSampleIndex = max(windowFromSample, findMappedSample(windowFromTime));
+    return;
+  }
+
+  if (formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    return;
+  }
+
+  // jump to the first block overlapping the window, blocks before it are not even read
+  auto& entries = getIndex();
+  for (const auto& entry : entries) {
+    if (entry.lastSimulationTime >= windowFromTime && entry.firstSampleIndex + entry.sampleCount > windowFromSample) {
+      in->clear();
+      in->seekg(static_cast<streamoff>(entry.offset));
+      nextSampleIndex = entry.firstSampleIndex;
+      return;
+    }
+  }
+}
+
+uint64_t FlightDataRecorderReader::getNumberOfMappedSamples() const {
+  return (mappedFile->getSize() - sizeof(interfaceVersion)) / sampleSize;
+}
+
+const unsigned char* FlightDataRecorderReader::getMappedSample(uint64_t sampleIndex) const {
+  return mappedFile->getData() + sizeof(interfaceVersion) + sampleIndex * sampleSize;
+}
+
+uint64_t FlightDataRecorderReader::findMappedSample(double simulationTime) const {
+  // binary search for the first sample not before the given time
+  uint64_t first = 0;
+  uint64_t last = getNumberOfMappedSamples();
+  while (first < last) {
+    auto middle = first + (last - first) / 2;
+    if (getSimulationTime(getMappedSample(middle)) < simulationTime) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+bool FlightDataRecorderReader::isInWindow(uint64_t sampleIndex, const unsigned char* sample) const {
+  if (sampleIndex < windowFromSample || sampleIndex > windowToSample) {
+    return false;
+  }
+  auto simulationTime = getSimulationTime(sample);
+  return simulationTime >= windowFromTime && simulationTime <= windowToTime;
+}
+
+bool FlightDataRecorderReader::readChunk(Chunk& chunk, size_t maximumNumberOfLegacySamples) {
+  if (isWindowPassed) {
+    return false;
+  }
+
+  // mapped legacy files -> chunk refers to the samples within the window in place
+  if (mappedFile != nullptr) {
+    auto numberOfSamplesInFile = getNumberOfMappedSamples();
+
+    // skip samples before the window
+    while (nextSampleIndex < numberOfSamplesInFile && !isInWindow(nextSampleIndex, getMappedSample(nextSampleIndex))) {
+      if (nextSampleIndex > windowToSample || getSimulationTime(getMappedSample(nextSampleIndex)) > windowToTime) {
+        isWindowPassed = true;
+        return false;
+      }
+      nextSampleIndex++;
+    }
+
+    // take samples until the chunk is full or the window ends
+    auto sampleCount = size_t(0);
+    auto maximumNumberOfSamples = max<size_t>(maximumNumberOfLegacySamples, 1);
+    while (nextSampleIndex + sampleCount < numberOfSamplesInFile && sampleCount < maximumNumberOfSamples &&
+           isInWindow(nextSampleIndex + sampleCount, getMappedSample(nextSampleIndex + sampleCount))) {
+      sampleCount++;
+    }
+    if (sampleCount == 0) {
+      return false;
+    }
+
+    chunk.header = {};
+    chunk.header.encoding = FlightDataRecorderFormat::BLOCK_ENCODING_ROWS;
+    chunk.header.compression = FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE;
+    chunk.header.sampleCount = static_cast<uint32_t>(sampleCount);
+    chunk.header.uncompressedSize = static_cast<uint32_t>(sampleCount * sampleSize);
+    chunk.header.firstSimulationTime = getSimulationTime(getMappedSample(nextSampleIndex));
+    chunk.header.lastSimulationTime = getSimulationTime(getMappedSample(nextSampleIndex + sampleCount - 1));
+    chunk.firstSampleIndex = nextSampleIndex;
+    chunk.mappedData = getMappedSample(nextSampleIndex);
+    chunk.payload.clear();
+    nextSampleIndex += sampleCount;
+    return true;
+  }
+  chunk.mappedData = nullptr;
+
+  // legacy files have no blocks -> pack the given number of samples into an uncompressed chunk
+  if (formatVersion == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+    while (true) {
+      chunk.payload.resize(max<size_t>(maximumNumberOfLegacySamples, 1) * sampleSize);
+      in->read(reinterpret_cast<char*>(chunk.payload.data()), chunk.payload.size());
+      auto sampleCount = static_cast<size_t>(in->gcount()) / sampleSize;
+      if (sampleCount == 0) {
+        return false;
+      }
+      chunk.payload.resize(sampleCount * sampleSize);
+      chunk.header = {};
+      chunk.header.encoding = FlightDataRecorderFormat::BLOCK_ENCODING_ROWS;
+      chunk.header.compression = FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE;
+      chunk.header.sampleCount = static_cast<uint32_t>(sampleCount);
+      chunk.header.uncompressedSize = static_cast<uint32_t>(chunk.payload.size());
+      chunk.header.firstSimulationTime = getSimulationTime(chunk.payload.data());
+      chunk.header.lastSimulationTime = getSimulationTime(chunk.payload.data() + (sampleCount - 1) * sampleSize);
+      chunk.firstSampleIndex = nextSampleIndex;
+      nextSampleIndex += sampleCount;
+
+      // stop after the window, skip chunks before it
+      if (chunk.firstSampleIndex > windowToSample || chunk.header.firstSimulationTime > windowToTime) {
+        isWindowPassed = true;
+        return false;
+      }
+      if (nextSampleIndex <= windowFromSample || chunk.header.lastSimulationTime < windowFromTime) {
+        continue;
+      }
+      return true;
+    }
+  }
+
+  while (true) {
+    // read chunk header
+    FlightDataRecorderFormat::ChunkHeader chunkHeader = {};
+    in->read(reinterpret_cast<char*>(&chunkHeader), sizeof(chunkHeader));
+    if (in->gcount() != sizeof(chunkHeader)) {
+      // regular end of file
+      return false;
+    }
+
+    // skip unknown chunks
+    if (chunkHeader.type != FlightDataRecorderFormat::CHUNK_TYPE_BLOCK) {
+      in->seekg(static_cast<streamoff>(chunkHeader.size), ios::cur);
+      continue;
+    }
+
+    // read block header and payload
+    if (chunkHeader.size < sizeof(FlightDataRecorderFormat::BlockHeader)) {
+      error = "Block chunk is too small!";
+      return false;
+    }
+    in->read(reinterpret_cast<char*>(&chunk.header), sizeof(chunk.header));
+    chunk.firstSampleIndex = nextSampleIndex;
+    nextSampleIndex += chunk.header.sampleCount;
+
+    // stop after the window, skip blocks before it without reading their payload
+    if (chunk.firstSampleIndex > windowToSample || chunk.header.firstSimulationTime > windowToTime) {
+      isWindowPassed = true;
+      return false;
+    }
+    if (nextSampleIndex <= windowFromSample || chunk.header.lastSimulationTime < windowFromTime) {
+      in->seekg(static_cast<streamoff>(chunkHeader.size - sizeof(chunk.header)), ios::cur);
+      continue;
+    }
+
+    chunk.payload.resize(chunkHeader.size - sizeof(chunk.header));
+    in->read(reinterpret_cast<char*>(chunk.payload.data()), chunk.payload.size());
+    if (static_cast<size_t>(in->gcount()) != chunk.payload.size()) {
+      error = "Unexpected end of file within chunk!";
+      return false;
+    }
+    return true;
+  }
+}
+
+bool FlightDataRecorderReader::readBlock() {
+  blockSampleCount = 0;
+  blockSampleIndex = 0;
+  return readChunk(blockChunk, LEGACY_SAMPLES_PER_BLOCK) && decodeChunk(blockChunk, blockBuffer, blockSamples, blockSampleCount, error);
+}
+
+double FlightDataRecorderReader::getSimulationTime(const unsigned char* sample) const {
+  // without simulation time all samples are considered to be at the requested time
+  if (simulationTimeField == nullptr) {
+    return numeric_limits<double>::infinity();
+  }
+  return FlightDataRecorderSchema::getValue(*simulationTimeField, sample);
+}
+
+void FlightDataRecorderReader::selectFields(const vector<FlightDataRecorderSchema::Field>& fields) {
+  selectedWords.assign((sampleSize + sizeof(uint64_t) - 1) / sizeof(uint64_t), false);
+  auto select = [this](const FlightDataRecorderSchema::Field& field) {
+    for (auto word = field.offset / sizeof(uint64_t); word * sizeof(uint64_t) < field.offset + field.size && word < selectedWords.size(); word++) {
+      selectedWords[word] = true;
+    }
+  };
+  for (const auto& field : fields) {
+    select(field);
+  }
+  if (simulationTimeField != nullptr) {
+    select(*simulationTimeField);
+  }
+}
+
+bool FlightDataRecorderReader::decodeChunk(const Chunk& chunk,
+                                           vector<unsigned char>& buffer,
+                                           const unsigned char*& samples,
+                                           size_t& numberOfSamples,
+                                           string& message) const {
+  const auto& header = chunk.header;
+  auto payload = chunk.mappedData != nullptr ? chunk.mappedData : chunk.payload.data();
+  auto payloadSize = chunk.mappedData != nullptr ? header.uncompressedSize : chunk.payload.size();
+  samples = nullptr;
+  numberOfSamples = 0;
+
+  // check block size, the size of sparse blocks depends on their content
+  if (header.encoding != FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE &&
+      header.uncompressedSize != static_cast<uint64_t>(header.sampleCount) * sampleSize) {
+    message = "Block size does not match sample count!";
+    return false;
+  }
+
+  // inflate, uncompressed data is used directly
+  vector<unsigned char> inflated;
+  const unsigned char* encoded = payload;
+  switch (header.compression) {
+    case FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE:
+      inflated.resize(header.uncompressedSize);
+      if (!inflateBlock(payload, payloadSize, inflated)) {
+        message = "Failed to decompress block!";
+        return false;
+      }
+      encoded = inflated.data();
+      break;
+    case FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE:
+      if (payloadSize != header.uncompressedSize) {
+        message = "Size of uncompressed block does not match!";
+        return false;
+      }
+      break;
+    default:
+      message = "Unknown block compression " + to_string(header.compression) + "!";
+      return false;
+  }
+
+  // restore samples, rows are used in place
+  auto size = static_cast<size_t>(header.sampleCount) * sampleSize;
+  switch (header.encoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      if (encoded == inflated.data()) {
+        buffer.swap(inflated);
+        encoded = buffer.data();
+      }
+      samples = encoded;
+      break;
+    case FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR:
+      buffer.resize(size);
+      FlightDataRecorderColumnarBlock::decode(encoded, sampleSize, header.sampleCount, buffer.data(),
+                                              selectedWords.empty() ? nullptr : &selectedWords);
+      samples = buffer.data();
+      break;
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      buffer.resize(size);
+      if (!FlightDataRecorderSparseBlock::decode(encoded, header.uncompressedSize, schema, sampleSize, header.sampleCount, buffer.data())) {
+        message = "Failed to decode sparse block!";
+        return false;
+      }
+      samples = buffer.data();
+      break;
+    default:
+      message = "Unknown block encoding " + to_string(header.encoding) + "!";
+      return false;
+  }
+  numberOfSamples = header.sampleCount;
+
+  // drop samples outside of the window at its borders
+  if (header.firstSimulationTime < windowFromTime || header.lastSimulationTime > windowToTime || chunk.firstSampleIndex < windowFromSample ||
+      chunk.firstSampleIndex + header.sampleCount - 1 > windowToSample) {
+    if (samples != buffer.data()) {
+      buffer.assign(samples, samples + size);
+    }
+    numberOfSamples = 0;
+    for (size_t i = 0; i < header.sampleCount; i++) {
+      auto sample = buffer.data() + i * sampleSize;
+      if (isInWindow(chunk.firstSampleIndex + i, sample)) {
+        memmove(buffer.data() + numberOfSamples * sampleSize, sample, sampleSize);
+        numberOfSamples++;
+      }
+    }
+    samples = buffer.data();
+  }
+
+  return true;
+}
+
+bool FlightDataRecorderReader::inflateBlock(const unsigned char* data, size_t size, vector<unsigned char>& target) {
+  z_stream stream = {};
+  if (inflateInit(&stream) != Z_OK) {
+    return false;
+  }
+
+  // the uncompressed size is known -> inflate in one call
+  stream.next_in = const_cast<Bytef*>(data);
+  stream.avail_in = static_cast<uInt>(size);
+  stream.next_out = target.data();
+  stream.avail_out = static_cast<uInt>(target.size());
+  auto result = inflate(&stream, Z_FINISH);
+  inflateEnd(&stream);
+
+  return result == Z_STREAM_END && stream.avail_out == 0;
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderFormat.h"
+#include "FlightDataRecorderInputBuffer.h"
+#include "FlightDataRecorderMappedFile.h"
+#include "FlightDataRecorderSample.h"
+#include "FlightDataRecorderSchema.h"
+
+// Reads samples from flight data recorder files. Legacy files (single gzip stream or uncompressed) and block based
+// files are detected by the magic at the start of the file. Block based files can be positioned at any block by
+// simulation time or sample index; only legacy files have to be read sequentially.
+//
+// Block based files carry the schema of their samples, so their raw samples can be decoded with readRaw() even if
+// the layout differs from the FlightDataRecorderSample compiled into the reader.
+//
+// The file path "-" reads from stdin. Streams are read strictly sequentially, so they have no block index and
+// blocks outside of a window are skipped by reading over them.
+//
+// Uncompressed legacy files are memory mapped. Their samples are handed out in place without copying and any sample
+// can be reached in constant time by its index.
+class FlightDataRecorderReader {
+ public:
+  bool open(const std::string& filePath, bool isCompressed);
+
+  uint32_t getFormatVersion() const;
+  uint64_t getInterfaceVersion() const;
+
+  // size of one sample in the file
+  uint32_t getSampleSize() const;
+
+  // fields of the samples, taken from the schema chunk of the file or from the layout registered for its interface
+  // version if the file has none (see FlightDataRecorderLayouts), the compiled layout is used for unknown versions
+  const std::vector<FlightDataRecorderSchema::Field>& getSchema() const;
+  bool hasFileSchema() const;
+  // true if the layout of the samples is known from the file or the registry
+  bool hasLayout() const;
+
+  // reads the next sample, returns false at the end of the file, if the file is corrupt or if the sample layout of
+  // the file does not match FlightDataRecorderSample
+  bool read(FlightDataRecorderSample& sample);
+
+  // returns the next raw sample of getSampleSize() bytes or nullptr at the end of the file, the pointer is valid
+  // until the next call
+  const unsigned char* readRaw();
+
+  const std::string& getError() const;
+
+  // bytes consumed from the file or stream, compressed bytes for gzip input
+  uint64_t getBytesRead() const;
+
+  // block index of the file, read from the index chunk or rebuilt from the block headers if the file was not closed
+  // regularly (empty for legacy files)
+  const std::vector<FlightDataRecorderFormat::IndexEntry>& getIndex();
+
+  // block of samples as stored in the file
+  struct Chunk {
+    FlightDataRecorderFormat::BlockHeader header;
+    uint64_t firstSampleIndex;
+    std::vector<unsigned char> payload;
+    // samples within a mapped file, used instead of the payload
+    const unsigned char* mappedData = nullptr;
+  };
+
+  // restricts reading to the samples within the window, bounds are inclusive; blocks outside of the window are
+  // skipped without decoding and reading stops at the first block after it (simulation time is assumed to increase
+  // monotonically); must be called before reading
+  void setSimulationTimeWindow(double from, double to);
+  void setSampleWindow(uint64_t from, uint64_t to);
+
+  // reads the next block without decoding it, legacy files are split into chunks of the given number of samples;
+  // together with decodeChunk() this allows to decode blocks in parallel, it must not be mixed with read() calls
+  bool readChunk(Chunk& chunk, size_t maximumNumberOfLegacySamples);
+
+  // restricts decoding to the given fields and the simulation time, other bytes of raw samples are undefined
+  void selectFields(const std::vector<FlightDataRecorderSchema::Field>& fields);
+
+  // decodes the samples of a chunk within the window into raw samples of getSampleSize() bytes, safe to call from
+  // several threads; uncompressed rows are not copied, so the samples either point into the buffer or into the chunk
+  // and stay valid as long as both are unchanged
+  bool decodeChunk(const Chunk& chunk,
+                   std::vector<unsigned char>& buffer,
+                   const unsigned char*& samples,
+                   size_t& numberOfSamples,
+                   std::string& message) const;
+
+  // statistics of the recorder stored when the file was closed, returns false if the file contains none
+  bool getStatistics(FlightDataRecorderFormat::Statistics& statistics);
+
+  // positions the reader at the first sample with a simulation time not before the given time
+  bool seekToSimulationTime(double simulationTime);
+
+  // positions the reader at the sample with the given index
+  bool seekToSample(uint64_t sampleIndex);
+
+ private:
+  std::unique_ptr<FlightDataRecorderInputBuffer> inBuffer;
+  std::unique_ptr<std::istream> in;
+  std::unique_ptr<FlightDataRecorderMappedFile> mappedFile;
+  uint64_t fileSize = 0;
+  std::string error;
+
+  uint32_t formatVersion = 0;
+  uint64_t interfaceVersion = 0;
+  FlightDataRecorderFormat::FileHeader fileHeader = {};
+  uint32_t sampleSize = 0;
+
+  std::vector<FlightDataRecorderSchema::Field> schema;
+  bool isFileSchema = false;
+  bool isRegisteredLayout = false;
+  const FlightDataRecorderSchema::Field* simulationTimeField = nullptr;
+
+  // window of samples to read
+  double windowFromTime = -std::numeric_limits<double>::infinity();
+  double windowToTime = std::numeric_limits<double>::infinity();
+  uint64_t windowFromSample = 0;
+  uint64_t windowToSample = std::numeric_limits<uint64_t>::max();
+  uint64_t nextSampleIndex = 0;
+  bool isWindowPassed = false;
+
+  // words of columnar blocks to decode, empty if all fields are used
+  std::vector<bool> selectedWords;
+
+  // samples of the current block
+  std::vector<unsigned char> compressedBlock;
+  std::vector<unsigned char> encodedBlock;
+  Chunk blockChunk;
+  std::vector<unsigned char> blockBuffer;
+  const unsigned char* blockSamples = nullptr;
+  size_t blockSampleCount = 0;
+  size_t blockSampleIndex = 0;
+
+  bool isIndexLoaded = false;
+  std::vector<FlightDataRecorderFormat::IndexEntry> index;
+  bool hasStatistics = false;
+  FlightDataRecorderFormat::Statistics statistics = {};
+
+  // samples per block when reading legacy files
+  static constexpr size_t LEGACY_SAMPLES_PER_BLOCK = 256;
+
+  bool useRegisteredLayout();
+  bool readSchemaChunk();
+  uint64_t getNumberOfMappedSamples() const;
+  const unsigned char* getMappedSample(uint64_t sampleIndex) const;
+  uint64_t findMappedSample(double simulationTime) const;
+  bool isInWindow(uint64_t sampleIndex, const unsigned char* sample) const;
+  void seekToWindow();
+  bool readBlock();
+  bool seekToBlock(size_t entry);
+
+  bool readIndexChunk();
+  void scanBlockHeaders();
+  double getSimulationTime(const unsigned char* sample) const;
+
+  static bool inflateBlock(const unsigned char* data, size_t size, std::vector<unsigned char>& target);
+};
@@ -0,0 +1,153 @@
+#include "FlightDataRecorderResampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+using namespace std;
+
+static double readDouble(const unsigned char* sample, uint32_t offset) {
+  double value;
+  memcpy(&value, sample + offset, sizeof(value));
+  return value;
+}
+
+FlightDataRecorderResampler::FlightDataRecorderResampler(const vector<FlightDataRecorderConverter::Column>& sampleColumns,
+                                                         const FlightDataRecorderSchema::Field& simulationTimeField,
+                                                         size_t resamplerSampleSize,
+                                                         double resamplerRate,
+                                                         const string& holdFieldList,
+                                                         bool withAggregates)
+    : simulationTimeOffset(simulationTimeField.offset), sampleSize(resamplerSampleSize), rate(resamplerRate), hasAggregates(withAggregates) {
+  vector<string> holdPatterns;
+  stringstream holdStream(holdFieldList.empty() ? DEFAULT_HOLD_FIELDS : holdFieldList);
+  string pattern;
+  while (getline(holdStream, pattern, ',')) {
+    holdPatterns.push_back(pattern);
+  }
+
+  for (const auto& column : sampleColumns) {
+    columns.push_back(column);
+    auto isContinuous = column.type == FlightDataRecorderSchema::FIELD_TYPE_REAL &&
+                        column.format == FlightDataRecorderConverter::COLUMN_FORMAT_NATIVE &&
+                        none_of(holdPatterns.begin(), holdPatterns.end(),
+                                [&column](const string& holdPattern) { return FlightDataRecorderSchema::matches(holdPattern, column.name); });
+    if (!isContinuous) {
+      continue;
+    }
+
+    // a field may be written in several columns but is interpolated once
+    auto position = find(continuousOffsets.begin(), continuousOffsets.end(), column.offset);
+    auto index = static_cast<uint32_t>(position - continuousOffsets.begin());
+    if (position == continuousOffsets.end()) {
+      continuousOffsets.push_back(column.offset);
+    }
+
+    // aggregates are placed behind the sample in the row
+    if (hasAggregates && column.offset != simulationTimeOffset) {
+      auto offset = static_cast<uint32_t>(sampleSize + index * 3 * sizeof(double));
+      columns.push_back({column.name + ".min", FlightDataRecorderSchema::FIELD_TYPE_REAL, offset, FlightDataRecorderConverter::COLUMN_FORMAT_NATIVE});
+      columns.push_back({column.name + ".max", FlightDataRecorderSchema::FIELD_TYPE_REAL, offset + 8, FlightDataRecorderConverter::COLUMN_FORMAT_NATIVE});
+      columns.push_back({column.name + ".mean", FlightDataRecorderSchema::FIELD_TYPE_REAL, offset + 16, FlightDataRecorderConverter::COLUMN_FORMAT_NATIVE});
+    }
+  }
+
+  aggregates.assign(continuousOffsets.size(), {numeric_limits<double>::infinity(), -numeric_limits<double>::infinity(), 0, 0});
+  row.resize(sampleSize + continuousOffsets.size() * 3 * sizeof(double));
+}
+
+const vector<FlightDataRecorderConverter::Column>& FlightDataRecorderResampler::getColumns() const {
+  return columns;
+}
+
+void FlightDataRecorderResampler::add(string& buffer, const string& delimiter, const unsigned char* samples, size_t numberOfSamples) {
+  const unsigned char* previous = hasPrevious ? previousSample.data() : nullptr;
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    auto sample = samples + i * sampleSize;
+    auto simulationTime = readDouble(sample, simulationTimeOffset);
+
+    // start the grid at the first sample or again if the time jumps backwards
+    if (previous != nullptr && simulationTime < readDouble(previous, simulationTimeOffset)) {
+      previous = nullptr;
+    }
+    if (previous == nullptr) {
+      gridIndex = static_cast<int64_t>(ceil(simulationTime * rate));
+      for (auto& aggregate : aggregates) {
+        aggregate = {numeric_limits<double>::infinity(), -numeric_limits<double>::infinity(), 0, 0};
+      }
+    } else {
+      // grid points between the previous sample and this one
+      auto previousTime = readDouble(previous, simulationTimeOffset);
+      while (getGridTime() < simulationTime) {
+        auto gridTime = getGridTime();
+        auto fraction = (gridTime - previousTime) / (simulationTime - previousTime);
+        memcpy(row.data(), previous, sampleSize);
+        for (auto offset : continuousOffsets) {
+          auto from = readDouble(previous, offset);
+          auto value = from + fraction * (readDouble(sample, offset) - from);
+          memcpy(row.data() + offset, &value, sizeof(value));
+        }
+        writeRow(buffer, delimiter, gridTime);
+      }
+    }
+
+    // a grid point at the time of the sample takes its values
+    if (hasAggregates) {
+      addToAggregates(sample);
+    }
+    if (getGridTime() <= simulationTime) {
+      memcpy(row.data(), sample, sampleSize);
+      writeRow(buffer, delimiter, getGridTime());
+    }
+    previous = sample;
+  }
+
+  // the next block starts at the last sample of this one
+  if (numberOfSamples > 0) {
+    previousSample.assign(previous, previous + sampleSize);
+    hasPrevious = true;
+  }
+}
+
+double FlightDataRecorderResampler::getGridTime() const {
+  return static_cast<double>(gridIndex) / rate;
+}
+
+void FlightDataRecorderResampler::addToAggregates(const unsigned char* sample) {
+  for (size_t i = 0; i < continuousOffsets.size(); i++) {
+    auto value = readDouble(sample, continuousOffsets[i]);
+    if (isnan(value)) {
+      continue;
+    }
+    auto& aggregate = aggregates[i];
+    aggregate.minimum = min(aggregate.minimum, value);
+    aggregate.maximum = max(aggregate.maximum, value);
+    aggregate.sum += value;
+    aggregate.count++;
+  }
+}
+
+void FlightDataRecorderResampler::writeRow(string& buffer, const string& delimiter, double simulationTime) {
+  // the row carries the grid time instead of the interpolated one
+  memcpy(row.data() + simulationTimeOffset, &simulationTime, sizeof(simulationTime));
+
+  // aggregates of the interval ending at this grid point, NaN if it contains no sample
+  if (hasAggregates) {
+    for (size_t i = 0; i < aggregates.size(); i++) {
+      auto& aggregate = aggregates[i];
+      double values[3] = {numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN()};
+      if (aggregate.count > 0) {
+        values[0] = aggregate.minimum;
+        values[1] = aggregate.maximum;
+        values[2] = aggregate.sum / static_cast<double>(aggregate.count);
+      }
+      memcpy(row.data() + sampleSize + i * sizeof(values), values, sizeof(values));
+      aggregate = {numeric_limits<double>::infinity(), -numeric_limits<double>::infinity(), 0, 0};
+    }
+  }
+
+  FlightDataRecorderConverter::writeSample(buffer, delimiter, columns, row.data());
+  gridIndex++;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderSchema.h"
+
+// Resamples raw samples onto a fixed grid of the simulation time (multiples of 1 / rate) and formats them as csv
+// rows. Continuous fields are interpolated linearly between the samples around a grid point, discrete fields hold the
+// last value before it. Booleans, integers and columns written as unsigned are always discrete, real fields are
+// continuous unless their name matches one of the hold patterns. The default patterns are anchored to the leaves of
+// modes, laws, flags and states stored as real values, so command signals below a law (e.g. ap_law.*.Theta_c_deg or
+// fbw.pitch.law_normal.nz_c_g) stay interpolated.
+//
+// Optionally every continuous column is followed by <name>.min, <name>.max and <name>.mean of the samples since the
+// previous grid point up to and including the current one; these columns are nan if no sample fell into the
+// interval. If the simulation time jumps backwards, e.g. after a reload, the grid restarts at the new time.
+//
+// Only the previous sample is kept, so memory does not depend on the length of the file.
+class FlightDataRecorderResampler {
+ public:
+  // real fields held at their last value if no patterns are given
+  static constexpr const char* DEFAULT_HOLD_FIELDS =
+      "*.law,*_law,*.mode,*_mode,*_mode_armed,*.mode_reversion_*,*.mode_requested,*_mode_?,*.enabled_AP?,*_on,*_on_override,"
+      "*_active,*_valid,*.flight_phase,*_handle_index,*State";
+
+  FlightDataRecorderResampler(const std::vector<FlightDataRecorderConverter::Column>& columns,
+                              const FlightDataRecorderSchema::Field& simulationTimeField,
+                              size_t sampleSize,
+                              double rate,
+                              const std::string& holdFieldList,
+                              bool hasAggregates);
+
+  // columns of the output rows including the aggregates
+  const std::vector<FlightDataRecorderConverter::Column>& getColumns() const;
+
+  // appends the rows of all grid points up to the last of the given samples, samples are passed in the order of the file
+  void add(std::string& buffer, const std::string& delimiter, const unsigned char* samples, size_t numberOfSamples);
+
+ private:
+  struct Aggregate {
+    double minimum;
+    double maximum;
+    double sum;
+    uint64_t count;
+  };
+
+  std::vector<FlightDataRecorderConverter::Column> columns;
+  uint32_t simulationTimeOffset;
+  size_t sampleSize;
+  double rate;
+  bool hasAggregates;
+
+  // offsets of the interpolated fields within a sample, each with the aggregate of the current interval
+  std::vector<uint32_t> continuousOffsets;
+  std::vector<Aggregate> aggregates;
+
+  // previous sample and the row being written, which has the aggregates behind the sample
+  std::vector<unsigned char> previousSample;
+  std::vector<unsigned char> row;
+  bool hasPrevious = false;
+  int64_t gridIndex = 0;
+
+  double getGridTime() const;
+  void addToAggregates(const unsigned char* sample);
+  // writes the row at the given grid time and advances the grid
+  void writeRow(std::string& buffer, const std::string& delimiter, double simulationTime);
+};
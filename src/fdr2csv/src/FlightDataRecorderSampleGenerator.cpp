@@ -0,0 +1,232 @@
+#include "FlightDataRecorderSampleGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <sstream>
+
+#include "FlightDataRecorderResampler.h"
+
+using namespace std;
+
+// profile of one flight, it repeats after the last point
+struct ProfilePoint {
+  double time;
+  double altitude;
+  double airspeed;
+};
+
+static const ProfilePoint PROFILE[] = {
+    {0, 0, 0},
+    {60, 0, 160},
+    {300, 8000, 250},
+    {900, 35000, 290},
+    {2400, 35000, 290},
+    {3300, 3000, 210},
+    {3540, 0, 140},
+    {3600, 0, 0},
+};
+
+static constexpr double PROFILE_DURATION = 3600;
+static constexpr double PI = 3.14159265358979323846;
+
+// fields driven by the profile, matched by the end of their path
+static const char* PROFILE_FIELD_NAMES[] = {
+    "time.dt",   "time.simulation_time", "aircraft_position.lat", "aircraft_position.lon", "aircraft_position.alt",
+    "H_ft",      "H_ind_ft",             "H_radio_ft",            "H_dot_ft_min",          "V_ias_kn",
+    "V_tas_kn",  "V_gnd_kn",             "V_mach",                "Theta_deg",             "Phi_deg",
+    "alpha_deg", "Psi_true_deg",         "Psi_magnetic_deg",      "Psi_magnetic_track_deg",
+};
+
+static bool endsWith(const string& path, const string& name) {
+  return path == name || (path.size() > name.size() && path.compare(path.size() - name.size(), name.size(), name) == 0 &&
+                          path[path.size() - name.size() - 1] == '.');
+}
+
+FlightDataRecorderSampleGenerator::FlightDataRecorderSampleGenerator(uint64_t seed, double generatorRate)
+    : random(seed), rate(generatorRate) {
+  vector<string> discretePatterns;
+  stringstream patternStream(FlightDataRecorderResampler::DEFAULT_HOLD_FIELDS);
+  string pattern;
+  while (getline(patternStream, pattern, ',')) {
+    discretePatterns.push_back(pattern);
+  }
+
+  for (const auto& field : FlightDataRecorderSchema::getFields()) {
+    auto name = find_if(begin(PROFILE_FIELD_NAMES), end(PROFILE_FIELD_NAMES), [&field](const char* name) { return endsWith(field.path, name); });
+    if (name != end(PROFILE_FIELD_NAMES)) {
+      profileFields.push_back({field, *name});
+      continue;
+    }
+
+    // the kind of signal is drawn once per field, modes stored as real values are discrete
+    Signal signal = {field, SIGNAL_TYPE_CONSTANT, 0, 0, {0, 0}, {0, 0}, 0, 0, 0, 0};
+    auto draw = getUniform(0, 1);
+    auto isDiscrete = any_of(discretePatterns.begin(), discretePatterns.end(),
+                             [&field](const string& pattern) { return FlightDataRecorderSchema::matches(pattern, field.path); });
+    switch (field.type) {
+      case FlightDataRecorderSchema::FIELD_TYPE_REAL:
+        if (isDiscrete) {
+          signal.type = draw < 0.3 ? SIGNAL_TYPE_CONSTANT : SIGNAL_TYPE_DISCRETE;
+          signal.numberOfModes = static_cast<uint32_t>(getUniform(2, 12));
+          signal.meanInterval = getUniform(10, 600);
+          break;
+        }
+        signal.value = draw < 0.5 ? 0 : round(getUniform(-100, 100));
+        signal.amplitude = pow(10, getUniform(-2, 3));
+        if (draw < 0.6) {
+          signal.type = SIGNAL_TYPE_CONSTANT;
+        } else if (draw < 0.9) {
+          signal.type = SIGNAL_TYPE_SMOOTH;
+          for (size_t i = 0; i < 2; i++) {
+            signal.frequencies[i] = 2 * PI / getUniform(10, 600);
+            signal.phases[i] = getUniform(0, 2 * PI);
+          }
+        } else {
+          signal.type = SIGNAL_TYPE_NOISY;
+          signal.noise = signal.amplitude * 1e-3;
+        }
+        break;
+      case FlightDataRecorderSchema::FIELD_TYPE_BOOLEAN:
+        signal.type = SIGNAL_TYPE_DISCRETE;
+        signal.numberOfModes = 2;
+        signal.meanInterval = getUniform(5, 600);
+        break;
+      case FlightDataRecorderSchema::FIELD_TYPE_INT32:
+      case FlightDataRecorderSchema::FIELD_TYPE_UINT32:
+        signal.type = draw < 0.3 ? SIGNAL_TYPE_CONSTANT : SIGNAL_TYPE_DISCRETE;
+        signal.numberOfModes = static_cast<uint32_t>(getUniform(2, 12));
+        signal.meanInterval = getUniform(10, 600);
+        break;
+      case FlightDataRecorderSchema::FIELD_TYPE_UINT64:
+        signal.type = SIGNAL_TYPE_COUNTER;
+        break;
+    }
+    signal.nextSwitchTime = signal.meanInterval > 0 ? -log(1 - getUniform(0, 1)) * signal.meanInterval : 0;
+    signals.push_back(signal);
+  }
+
+  heading = getUniform(0, 360);
+  latitude = getUniform(-60, 60);
+  longitude = getUniform(-180, 180);
+}
+
+void FlightDataRecorderSampleGenerator::next(FlightDataRecorderSample& sample) {
+  auto data = reinterpret_cast<unsigned char*>(&sample);
+  auto dt = (1 + getNormal(0.05)) / rate;
+  simulationTime += dt;
+
+  // position within the profile, altitude and speed are interpolated linearly between its points
+  auto profileTime = fmod(simulationTime, PROFILE_DURATION);
+  auto point = upper_bound(begin(PROFILE) + 1, end(PROFILE) - 1, profileTime, [](double time, const ProfilePoint& p) { return time < p.time; });
+  const auto& from = *(point - 1);
+  const auto& to = *point;
+  auto fraction = (profileTime - from.time) / (to.time - from.time);
+  auto altitude = from.altitude + fraction * (to.altitude - from.altitude);
+  auto airspeed = from.airspeed + fraction * (to.airspeed - from.airspeed);
+  auto verticalSpeed = (to.altitude - from.altitude) / (to.time - from.time) * 60;
+  auto pitch = clamp(2 + verticalSpeed / 1000 * 2.5, -5.0, 15.0) * min(airspeed / 140, 1.0);
+
+  // turns of one minute every five minutes in cruise
+  auto bank = 0.0;
+  if (altitude >= 35000 && fmod(profileTime, 300) < 60) {
+    bank = 25 * sin(PI * fmod(profileTime, 300) / 60) * (fmod(profileTime, 600) < 300 ? 1 : -1);
+  }
+  auto trueAirspeed = airspeed * (1 + altitude / 1000 * 0.02);
+  if (trueAirspeed > 1) {
+    heading = fmod(heading + 1091 * tan(bank * PI / 180) / trueAirspeed * dt + 360, 360);
+  }
+  latitude += trueAirspeed * cos(heading * PI / 180) / 3600 / 60 * dt;
+  longitude += trueAirspeed * sin(heading * PI / 180) / 3600 / 60 * dt / max(cos(latitude * PI / 180), 0.01);
+
+  for (const auto& profileField : profileFields) {
+    double value;
+    if (profileField.name == "time.dt") {
+      value = dt;
+    } else if (profileField.name == "time.simulation_time") {
+      value = simulationTime;
+    } else if (profileField.name == "aircraft_position.lat") {
+      value = latitude;
+    } else if (profileField.name == "aircraft_position.lon") {
+      value = longitude;
+    } else {
+      value = getProfileValue(profileField.name, altitude, verticalSpeed, airspeed, pitch, bank);
+    }
+    FlightDataRecorderSchema::setValue(profileField.field, data, value);
+  }
+
+  for (auto& signal : signals) {
+    switch (signal.type) {
+      case SIGNAL_TYPE_CONSTANT:
+        break;
+      case SIGNAL_TYPE_SMOOTH:
+        FlightDataRecorderSchema::setValue(signal.field, data,
+                                           signal.value + signal.amplitude * (sin(signal.frequencies[0] * simulationTime + signal.phases[0]) +
+                                                                              0.3 * sin(signal.frequencies[1] * simulationTime + signal.phases[1])));
+        continue;
+      case SIGNAL_TYPE_NOISY:
+        signal.value += getNormal(signal.noise);
+        break;
+      case SIGNAL_TYPE_DISCRETE:
+        // switches are a poisson process
+        while (simulationTime >= signal.nextSwitchTime) {
+          signal.value = floor(getUniform(0, signal.numberOfModes));
+          signal.nextSwitchTime += -log(1 - getUniform(0, 1)) * signal.meanInterval;
+        }
+        break;
+      case SIGNAL_TYPE_COUNTER:
+        signal.value++;
+        break;
+    }
+    FlightDataRecorderSchema::setValue(signal.field, data, signal.value);
+  }
+}
+
+double FlightDataRecorderSampleGenerator::getUniform(double from, double to) {
+  return uniform_real_distribution<double>(from, to)(random);
+}
+
+double FlightDataRecorderSampleGenerator::getNormal(double deviation) {
+  return deviation > 0 ? normal_distribution<double>(0, deviation)(random) : 0;
+}
+
+double FlightDataRecorderSampleGenerator::getProfileValue(const string& name,
+                                                          double altitude,
+                                                          double verticalSpeed,
+                                                          double airspeed,
+                                                          double pitch,
+                                                          double bank) const {
+  auto trueAirspeed = airspeed * (1 + altitude / 1000 * 0.02);
+  if (name == "aircraft_position.alt" || name == "H_ft" || name == "H_ind_ft") {
+    return altitude;
+  }
+  if (name == "H_radio_ft") {
+    return min(altitude, 2500.0);
+  }
+  if (name == "H_dot_ft_min") {
+    return verticalSpeed;
+  }
+  if (name == "V_ias_kn") {
+    return airspeed;
+  }
+  if (name == "V_tas_kn" || name == "V_gnd_kn") {
+    return trueAirspeed;
+  }
+  if (name == "V_mach") {
+    return trueAirspeed / 661.5;
+  }
+  if (name == "Theta_deg") {
+    return pitch;
+  }
+  if (name == "Phi_deg") {
+    return bank;
+  }
+  if (name == "alpha_deg") {
+    return 2.5 + pitch * 0.3;
+  }
+  // magnetic variation is constant
+  if (name == "Psi_true_deg") {
+    return heading;
+  }
+  return fmod(heading + 357, 360);
+}
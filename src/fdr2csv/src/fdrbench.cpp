@@ -0,0 +1,197 @@
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderColumnarBlock.h"
+#include "FlightDataRecorderCompressor.h"
+#include "FlightDataRecorderFormat.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderSample.h"
+#include "FlightDataRecorderSchema.h"
+#include "FlightDataRecorderSparseBlock.h"
+
+using namespace std;
+
+struct Configuration {
+  FlightDataRecorderFormat::BlockEncoding encoding;
+  FlightDataRecorderFormat::BlockCompression compression;
+  int level;
+  string strategy;
+};
+
+struct Result {
+  double seconds;
+  uint64_t bytesWritten;
+};
+
+static const char* getEncodingName(FlightDataRecorderFormat::BlockEncoding encoding) {
+  switch (encoding) {
+    case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS:
+      return "ROWS";
+    case FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR:
+      return "COLUMNAR";
+    case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+      return "SPARSE";
+  }
+  return "UNKNOWN";
+}
+
+static Result run(const Configuration& configuration,
+                  const vector<FlightDataRecorderSample>& samples,
+                  size_t samplesPerBlock,
+                  const string& temporaryFilePath) {
+  const auto& fields = FlightDataRecorderSchema::getFields();
+  auto alwaysSet = FlightDataRecorderSparseBlock::getAlwaysChangingFields(fields);
+  FlightDataRecorderColumnarBlock columnarBlock;
+  FlightDataRecorderSparseBlock sparseBlock;
+  columnarBlock.initialize(sizeof(FlightDataRecorderSample), samplesPerBlock);
+  sparseBlock.initialize(fields, alwaysSet, sizeof(FlightDataRecorderSample), samplesPerBlock);
+
+  FlightDataRecorderCompressor compressor;
+  auto start = chrono::high_resolution_clock::now();
+  compressor.open(temporaryFilePath, FlightDataRecorderCompressor::Mode::CHUNKED, configuration.level,
+                  FlightDataRecorderCompressor::getStrategy(configuration.strategy));
+
+  // encode and compress the samples block by block like the recorder does
+  for (size_t first = 0; first < samples.size(); first += samplesPerBlock) {
+    auto count = min(samplesPerBlock, samples.size() - first);
+    vector<unsigned char> data;
+    switch (configuration.encoding) {
+      case FlightDataRecorderFormat::BLOCK_ENCODING_ROWS: {
+        auto bytes = reinterpret_cast<const unsigned char*>(&samples[first]);
+        data.assign(bytes, bytes + count * sizeof(FlightDataRecorderSample));
+        break;
+      }
+      case FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR:
+        for (size_t i = 0; i < count; i++) {
+          columnarBlock.add(&samples[first + i]);
+        }
+        columnarBlock.finish(data);
+        break;
+      case FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE:
+        for (size_t i = 0; i < count; i++) {
+          sparseBlock.add(&samples[first + i]);
+        }
+        sparseBlock.finish(data);
+        break;
+    }
+
+    vector<unsigned char> header(sizeof(FlightDataRecorderFormat::BlockHeader));
+    FlightDataRecorderFormat::BlockHeader blockHeader = {};
+    blockHeader.encoding = configuration.encoding;
+    blockHeader.compression = configuration.compression;
+    blockHeader.sampleCount = static_cast<uint32_t>(count);
+    blockHeader.uncompressedSize = static_cast<uint32_t>(data.size());
+    memcpy(header.data(), &blockHeader, sizeof(blockHeader));
+    compressor.queueChunk(FlightDataRecorderFormat::CHUNK_TYPE_BLOCK, std::move(header), std::move(data),
+                          configuration.compression == FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE);
+    compressor.process(chrono::microseconds::zero());
+  }
+
+  compressor.close();
+  auto end = chrono::high_resolution_clock::now();
+
+  return {chrono::duration<double>(end - start).count(), compressor.getBytesWritten()};
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string inFilePath;
+  string temporaryFilePath = (filesystem::temp_directory_path() / "fdrbench.fdr").string();
+  uint32_t samplesPerBlock = 256;
+  uint32_t repetitions = 3;
+  bool noCompression = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Replays a fdr file through the compression settings of the recorder and reports throughput and ratio as csv");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Input File");
+  args.addArgument({"-t", "--temporary-file"}, &temporaryFilePath, "File written during the benchmark");
+  args.addArgument({"-b", "--samples-per-block"}, &samplesPerBlock, "Samples per block");
+  args.addArgument({"-r", "--repetitions"}, &repetitions, "Repetitions per configuration, the fastest is reported");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (inFilePath.empty()) {
+    cout << "Input file parameter missing!" << endl;
+    return 1;
+  }
+  samplesPerBlock = max(samplesPerBlock, 1u);
+  repetitions = max(repetitions, 1u);
+
+  // read all samples into memory
+  FlightDataRecorderReader reader;
+  if (!reader.open(inFilePath, !noCompression)) {
+    cout << reader.getError() << endl;
+    return 1;
+  }
+  vector<FlightDataRecorderSample> samples;
+  FlightDataRecorderSample sample;
+  while (reader.read(sample)) {
+    samples.push_back(sample);
+  }
+  if (!reader.getError().empty()) {
+    cout << "ERROR: " << reader.getError() << endl;
+    return 1;
+  }
+  if (samples.empty()) {
+    cout << "Input file contains no samples!" << endl;
+    return 1;
+  }
+
+  // build configurations
+  vector<Configuration> configurations;
+  for (auto encoding : {FlightDataRecorderFormat::BLOCK_ENCODING_ROWS, FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR,
+                        FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE}) {
+    configurations.push_back({encoding, FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE, 0, "DEFAULT"});
+    for (auto level : {1, 6, 9}) {
+      for (auto strategy : {"DEFAULT", "FILTERED", "RLE"}) {
+        configurations.push_back({encoding, FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE, level, strategy});
+      }
+    }
+  }
+
+  // run and report
+  auto inputBytes = static_cast<double>(samples.size() * sizeof(FlightDataRecorderSample));
+  cout << "encoding,codec,level,strategy,samples,bytes_in,bytes_out,ratio,mb_per_s" << endl;
+  for (const auto& configuration : configurations) {
+    Result best = {};
+    for (uint32_t i = 0; i < repetitions; i++) {
+      auto result = run(configuration, samples, samplesPerBlock, temporaryFilePath);
+      if (i == 0 || result.seconds < best.seconds) {
+        best = result;
+      }
+    }
+    cout << getEncodingName(configuration.encoding) << ",";
+    cout << (configuration.compression == FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE ? "NONE" : "DEFLATE") << ",";
+    cout << configuration.level << "," << configuration.strategy << "," << samples.size() << ",";
+    cout << static_cast<uint64_t>(inputBytes) << "," << best.bytesWritten << ",";
+    cout << fixed << setprecision(2) << inputBytes / best.bytesWritten << ",";
+    cout << inputBytes / best.seconds / 1e6 << defaultfloat << endl;
+  }
+
+  // clean up
+  filesystem::remove(temporaryFilePath);
+
+  return 0;
+}
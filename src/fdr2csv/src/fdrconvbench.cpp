@@ -0,0 +1,271 @@
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderFileWriter.h"
+#include "FlightDataRecorderPipeline.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderSampleGenerator.h"
+
+using namespace std;
+
+// file layout under test
+struct Variant {
+  const char* name;
+  FlightDataRecorderFileWriter::Settings settings;
+};
+
+// measurement of one stage, sizes in bytes
+struct Measurement {
+  double seconds;
+  uint64_t numberOfSamples;
+  uint64_t bytesIn;
+  uint64_t bytesOut;
+};
+
+// samples per formatted block, like the pipeline uses for legacy files
+static constexpr size_t SAMPLES_PER_BLOCK = 1024;
+
+// buffer of the csv output file
+static constexpr size_t OUTPUT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+static bool isCompressedInput(const Variant& variant) {
+  // uncompressed legacy files are read through the memory mapping
+  return variant.settings.formatVersion != FlightDataRecorderFormat::FORMAT_VERSION_LEGACY ||
+         variant.settings.compression != FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE;
+}
+
+// inflates and decodes all blocks of the file
+static bool measureDecode(const string& filePath, bool isCompressed, Measurement& measurement, string& error) {
+  auto start = chrono::steady_clock::now();
+  FlightDataRecorderReader reader;
+  if (!reader.open(filePath, isCompressed)) {
+    error = reader.getError();
+    return false;
+  }
+  FlightDataRecorderReader::Chunk chunk;
+  vector<unsigned char> buffer;
+  measurement = {};
+  while (reader.readChunk(chunk, SAMPLES_PER_BLOCK)) {
+    const unsigned char* samples = nullptr;
+    size_t numberOfSamples = 0;
+    if (!reader.decodeChunk(chunk, buffer, samples, numberOfSamples, error)) {
+      return false;
+    }
+    measurement.numberOfSamples += numberOfSamples;
+  }
+  measurement.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  measurement.bytesIn = reader.getBytesRead();
+  measurement.bytesOut = measurement.numberOfSamples * reader.getSampleSize();
+  error = reader.getError();
+  return error.empty();
+}
+
+// formats samples held in memory as csv rows with the columns of fdr2csv
+static void measureFormat(const vector<unsigned char>& samples, Measurement& measurement) {
+  const auto& columns = FlightDataRecorderConverter::getLegacyColumns();
+  auto numberOfSamples = samples.size() / sizeof(FlightDataRecorderSample);
+  string buffer;
+  measurement = {};
+  auto start = chrono::steady_clock::now();
+  for (size_t first = 0; first < numberOfSamples; first += SAMPLES_PER_BLOCK) {
+    buffer.clear();
+    for (size_t i = first; i < min(first + SAMPLES_PER_BLOCK, numberOfSamples); i++) {
+      FlightDataRecorderConverter::writeSample(buffer, ",", columns, samples.data() + i * sizeof(FlightDataRecorderSample));
+    }
+    measurement.bytesOut += buffer.size();
+  }
+  measurement.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  measurement.numberOfSamples = numberOfSamples;
+  measurement.bytesIn = samples.size();
+}
+
+// converts the file to a csv file like fdr2csv does, from opening the input to closing the output
+static bool measureConvert(const string& filePath,
+                           bool isCompressed,
+                           const string& outFilePath,
+                           uint32_t numberOfJobs,
+                           Measurement& measurement,
+                           string& error) {
+  measurement = {};
+  auto start = chrono::steady_clock::now();
+  FlightDataRecorderReader reader;
+  if (!reader.open(filePath, isCompressed)) {
+    error = reader.getError();
+    return false;
+  }
+  vector<char> outBuffer(OUTPUT_BUFFER_SIZE);
+  ofstream out;
+  out.rdbuf()->pubsetbuf(outBuffer.data(), static_cast<streamsize>(outBuffer.size()));
+  out.open(outFilePath, ios::out | ios::trunc);
+  if (!out.is_open()) {
+    error = "Failed to create output file!";
+    return false;
+  }
+
+  const auto& columns = FlightDataRecorderConverter::getLegacyColumns();
+  FlightDataRecorderConverter::writeHeader(out, ",", columns);
+  auto sampleSize = reader.getSampleSize();
+  auto formatter = [&columns, sampleSize](string& buffer, const unsigned char* samples, size_t numberOfSamples) {
+    for (size_t i = 0; i < numberOfSamples; i++) {
+      FlightDataRecorderConverter::writeSample(buffer, ",", columns, samples + i * sampleSize);
+    }
+  };
+  auto writer = [&out, &measurement](const string& buffer, size_t) {
+    out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+    measurement.bytesOut += buffer.size();
+    return static_cast<bool>(out);
+  };
+  auto progress = [&measurement](uint64_t numberOfSamples) { measurement.numberOfSamples = numberOfSamples; };
+  FlightDataRecorderPipeline pipeline(reader, numberOfJobs);
+  if (!pipeline.run(formatter, writer, progress)) {
+    error = pipeline.getError();
+    return false;
+  }
+  out.close();
+  if (out.fail()) {
+    error = "Failed to write output!";
+    return false;
+  }
+  measurement.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  measurement.bytesIn = reader.getBytesRead();
+  return true;
+}
+
+// runs a measurement several times and keeps the fastest
+static bool measureBest(uint32_t repetitions, const function<bool(Measurement&)>& measure, Measurement& best) {
+  for (uint32_t i = 0; i < repetitions; i++) {
+    Measurement measurement = {};
+    if (!measure(measurement)) {
+      return false;
+    }
+    if (i == 0 || measurement.seconds < best.seconds) {
+      best = measurement;
+    }
+  }
+  return true;
+}
+
+static void printMeasurement(const string& variant, const char* stage, const Measurement& measurement) {
+  // throughput is given for the uncompressed samples, so stages and variants are comparable
+  auto sampleBytes = static_cast<double>(measurement.numberOfSamples * sizeof(FlightDataRecorderSample));
+  cout << variant << "," << stage << "," << measurement.numberOfSamples << "," << measurement.bytesIn << "," << measurement.bytesOut << ",";
+  cout << fixed << setprecision(6) << measurement.seconds << "," << setprecision(2) << sampleBytes / measurement.seconds / 1e6 << ",";
+  cout << setprecision(0) << static_cast<double>(measurement.numberOfSamples) / measurement.seconds << defaultfloat << endl;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  double sizeInMegabytes = 50;
+  uint32_t numberOfJobs = max(thread::hardware_concurrency(), 1u);
+  uint32_t repetitions = 3;
+  uint32_t seed = 1;
+  string temporaryDirectory = filesystem::temp_directory_path().string();
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args(
+      "Generates synthetic fdr files in several layouts and measures decoding, csv formatting and end-to-end conversion, results are "
+      "written as csv");
+  args.addArgument({"-s", "--size"}, &sizeInMegabytes, "Size of the samples before compression in MB (default: 50)");
+  args.addArgument({"-j", "--jobs"}, &numberOfJobs, "Number of threads of the conversion (default: number of cores)");
+  args.addArgument({"-r", "--repetitions"}, &repetitions, "Repetitions per measurement, the fastest is reported");
+  args.addArgument({"-x", "--seed"}, &seed, "Seed of the synthetic samples (default: 1)");
+  args.addArgument({"-t", "--temporary-directory"}, &temporaryDirectory, "Directory of the files written during the benchmark");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+  repetitions = max(repetitions, 1u);
+  numberOfJobs = max(numberOfJobs, 1u);
+
+  static const Variant VARIANTS[] = {
+      {"legacy_gzip",
+       {FlightDataRecorderFormat::FORMAT_VERSION_LEGACY, FlightDataRecorderFormat::BLOCK_ENCODING_ROWS,
+        FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE, -1, 256}},
+      {"legacy_raw",
+       {FlightDataRecorderFormat::FORMAT_VERSION_LEGACY, FlightDataRecorderFormat::BLOCK_ENCODING_ROWS, FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE,
+        -1, 256}},
+      {"rows_none",
+       {FlightDataRecorderFormat::FORMAT_VERSION, FlightDataRecorderFormat::BLOCK_ENCODING_ROWS, FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE, -1,
+        256}},
+      {"columnar_deflate",
+       {FlightDataRecorderFormat::FORMAT_VERSION, FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR, FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE,
+        -1, 256}},
+      {"sparse_deflate",
+       {FlightDataRecorderFormat::FORMAT_VERSION, FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE, FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE,
+        -1, 256}},
+  };
+
+  // the samples are generated once and written in every layout
+  auto numberOfSamples = static_cast<size_t>(sizeInMegabytes * 1e6 / sizeof(FlightDataRecorderSample));
+  vector<unsigned char> samples(numberOfSamples * sizeof(FlightDataRecorderSample));
+  FlightDataRecorderSampleGenerator generator(seed, 30);
+  auto sample = make_unique<FlightDataRecorderSample>();
+  for (size_t i = 0; i < numberOfSamples; i++) {
+    generator.next(*sample);
+    memcpy(samples.data() + i * sizeof(FlightDataRecorderSample), sample.get(), sizeof(FlightDataRecorderSample));
+  }
+
+  cout << "variant,stage,samples,bytes_in,bytes_out,seconds,mb_per_s,samples_per_s" << endl;
+  auto outFilePath = (filesystem::path(temporaryDirectory) / "fdrconvbench.csv").string();
+  Measurement measurement = {};
+  measureBest(repetitions, [&samples](Measurement& result) { measureFormat(samples, result); return true; }, measurement);
+  printMeasurement("memory", "format", measurement);
+
+  auto isOk = true;
+  for (const auto& variant : VARIANTS) {
+    auto filePath = (filesystem::path(temporaryDirectory) / (string("fdrconvbench_") + variant.name + ".fdr")).string();
+    FlightDataRecorderFileWriter writer;
+    if (!writer.open(filePath, variant.settings)) {
+      cerr << "Failed to create '" << filePath << "'!" << endl;
+      return 1;
+    }
+    for (size_t i = 0; i < numberOfSamples; i++) {
+      writer.write(*reinterpret_cast<const FlightDataRecorderSample*>(samples.data() + i * sizeof(FlightDataRecorderSample)));
+    }
+    if (!writer.close()) {
+      cerr << "Failed to write '" << filePath << "'!" << endl;
+      return 1;
+    }
+
+    string error;
+    auto isCompressed = isCompressedInput(variant);
+    if (measureBest(repetitions, [&](Measurement& result) { return measureDecode(filePath, isCompressed, result, error); }, measurement)) {
+      printMeasurement(variant.name, "decode", measurement);
+    }
+    if (measureBest(repetitions, [&](Measurement& result) { return measureConvert(filePath, isCompressed, outFilePath, numberOfJobs, result, error); },
+                    measurement)) {
+      printMeasurement(variant.name, "convert", measurement);
+    }
+    if (!error.empty()) {
+      cerr << variant.name << ": " << error << endl;
+      isOk = false;
+    }
+    filesystem::remove(filePath);
+  }
+  filesystem::remove(outFilePath);
+
+  return isOk ? 0 : 1;
+}
@@ -0,0 +1,235 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderDiff.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderSchema.h"
+
+using namespace std;
+
+// samples compared at once
+static constexpr size_t SAMPLES_PER_BATCH = 1024;
+
+// field present in both files with its tolerance and result
+struct ComparedField {
+  FlightDataRecorderSchema::Field before;
+  FlightDataRecorderSchema::Field after;
+  FlightDataRecorderDiff::Tolerance tolerance;
+  FlightDataRecorderDiff::Result result;
+};
+
+// reads the next samples of a file into a batch of rows
+static size_t readBatch(FlightDataRecorderReader& reader, vector<unsigned char>& rows) {
+  auto sampleSize = reader.getSampleSize();
+  rows.resize(SAMPLES_PER_BATCH * sampleSize);
+  size_t numberOfSamples = 0;
+  while (numberOfSamples < SAMPLES_PER_BATCH) {
+    auto sample = reader.readRaw();
+    if (sample == nullptr) {
+      break;
+    }
+    memcpy(rows.data() + numberOfSamples * sampleSize, sample, sampleSize);
+    numberOfSamples++;
+  }
+  return numberOfSamples;
+}
+
+// applies tolerances like "fbw.sim.data.*=0.01/0.001,ap_sm.output.*=0" (absolute/relative), the last match wins
+static bool applyTolerances(const string& toleranceList, vector<ComparedField>& fields) {
+  stringstream toleranceStream(toleranceList);
+  string entry;
+  while (getline(toleranceStream, entry, ',')) {
+    auto separator = entry.find('=');
+    if (separator == string::npos) {
+      cout << "Invalid tolerance '" << entry << "'!" << endl;
+      return false;
+    }
+    auto pattern = entry.substr(0, separator);
+    FlightDataRecorderDiff::Tolerance tolerance = {0, 0};
+    char slash = 0;
+    stringstream valueStream(entry.substr(separator + 1));
+    valueStream >> tolerance.absolute;
+    if (valueStream >> slash) {
+      valueStream >> tolerance.relative;
+    }
+    if (valueStream.fail() || (slash != 0 && slash != '/')) {
+      cout << "Invalid tolerance '" << entry << "'!" << endl;
+      return false;
+    }
+    for (auto& field : fields) {
+      if (FlightDataRecorderSchema::matches(pattern, field.before.path)) {
+        field.tolerance = tolerance;
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string beforeFilePath;
+  string afterFilePath;
+  string fieldList = "*";
+  double absoluteTolerance = 0;
+  double relativeTolerance = 0;
+  string toleranceList;
+  bool noCompression = false;
+  bool printAllFields = false;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Compares two fdr files sample by sample and reports the largest error and first divergence per field as csv");
+  args.addArgument({"-b", "--before"}, &beforeFilePath, "Reference file");
+  args.addArgument({"-a", "--after"}, &afterFilePath, "File compared against the reference");
+  args.addArgument({"-f", "--fields"}, &fieldList, "Comma separated list of fields or patterns to compare (default: all)");
+  args.addArgument({"-t", "--absolute-tolerance"}, &absoluteTolerance, "Allowed absolute difference");
+  args.addArgument({"-r", "--relative-tolerance"}, &relativeTolerance, "Allowed difference relative to the reference value");
+  args.addArgument({"-p", "--tolerances"}, &toleranceList, "Tolerances per field like fbw.sim.data.*=0.01/0.001 (absolute/relative)");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Input files are not compressed");
+  args.addArgument({"-v", "--all-fields"}, &printAllFields, "Print fields without divergence as well");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (beforeFilePath.empty() || afterFilePath.empty()) {
+    cout << "Input file parameter missing!" << endl;
+    return 2;
+  }
+
+  // open both files, their layouts may differ as fields are matched by name
+  FlightDataRecorderReader before;
+  FlightDataRecorderReader after;
+  if (!before.open(beforeFilePath, !noCompression)) {
+    cout << beforeFilePath << ": " << before.getError() << endl;
+    return 2;
+  }
+  if (!after.open(afterFilePath, !noCompression)) {
+    cout << afterFilePath << ": " << after.getError() << endl;
+    return 2;
+  }
+
+  // fields of the reference that match the patterns and exist in both files
+  vector<ComparedField> fields;
+  vector<FlightDataRecorderSchema::Field> beforeFields;
+  vector<FlightDataRecorderSchema::Field> afterFields;
+  stringstream fieldStream(fieldList);
+  string pattern;
+  while (getline(fieldStream, pattern, ',')) {
+    for (const auto& field : before.getSchema()) {
+      if (!FlightDataRecorderSchema::matches(pattern, field.path) || FlightDataRecorderSchema::find(beforeFields, field.path) != nullptr) {
+        continue;
+      }
+      auto afterField = FlightDataRecorderSchema::find(after.getSchema(), field.path);
+      if (afterField == nullptr) {
+        cerr << "Field '" << field.path << "' is missing in '" << afterFilePath << "'" << endl;
+        continue;
+      }
+      fields.push_back({field, *afterField, {absoluteTolerance, relativeTolerance}, {}});
+      beforeFields.push_back(field);
+      afterFields.push_back(*afterField);
+    }
+  }
+  if (fields.empty()) {
+    cout << "No fields to compare!" << endl;
+    return 2;
+  }
+  if (!applyTolerances(toleranceList, fields)) {
+    return 2;
+  }
+
+  // only compared fields are decoded
+  before.selectFields(beforeFields);
+  after.selectFields(afterFields);
+
+  // compare both files in lockstep, batch by batch and column by column
+  auto simulationTimeField = FlightDataRecorderSchema::find(before.getSchema(), "ap_sm.time.simulation_time");
+  vector<double> simulationTimes(SAMPLES_PER_BATCH);
+  vector<unsigned char> beforeRows;
+  vector<unsigned char> afterRows;
+  vector<double> beforeColumn(SAMPLES_PER_BATCH);
+  vector<double> afterColumn(SAMPLES_PER_BATCH);
+  uint64_t numberOfSamples = 0;
+  uint64_t numberOfBeforeSamples = 0;
+  uint64_t numberOfAfterSamples = 0;
+  while (true) {
+    auto numberOfBatchBeforeSamples = readBatch(before, beforeRows);
+    auto numberOfBatchAfterSamples = readBatch(after, afterRows);
+    numberOfBeforeSamples += numberOfBatchBeforeSamples;
+    numberOfAfterSamples += numberOfBatchAfterSamples;
+    auto numberOfBatchSamples = min(numberOfBatchBeforeSamples, numberOfBatchAfterSamples);
+    if (numberOfBatchSamples == 0) {
+      break;
+    }
+
+    // times of the batch for the samples reported
+    if (simulationTimeField != nullptr) {
+      FlightDataRecorderDiff::extractColumn(*simulationTimeField, beforeRows.data(), before.getSampleSize(), numberOfBatchSamples,
+                                            simulationTimes.data());
+    }
+    auto batchSimulationTimes = simulationTimeField != nullptr ? simulationTimes.data() : nullptr;
+
+    for (auto& field : fields) {
+      FlightDataRecorderDiff::extractColumn(field.before, beforeRows.data(), before.getSampleSize(), numberOfBatchSamples,
+                                            beforeColumn.data());
+      FlightDataRecorderDiff::extractColumn(field.after, afterRows.data(), after.getSampleSize(), numberOfBatchSamples, afterColumn.data());
+      FlightDataRecorderDiff::compare(beforeColumn.data(), afterColumn.data(), batchSimulationTimes, numberOfBatchSamples, field.tolerance,
+                                      numberOfSamples, field.result);
+    }
+    numberOfSamples += numberOfBatchSamples;
+  }
+  for (const auto* reader : {&before, &after}) {
+    if (!reader->getError().empty()) {
+      cout << "ERROR: " << reader->getError() << endl;
+      return 2;
+    }
+  }
+
+  // report
+  auto getTime = [](double simulationTime) {
+    return isnan(simulationTime) ? string() : to_string(simulationTime);
+  };
+  size_t numberOfDivergentFields = 0;
+  cout << "field,max_error,max_error_sample,max_error_time,first_divergence_sample,first_divergence_time,divergent_samples" << endl;
+  for (const auto& field : fields) {
+    const auto& result = field.result;
+    auto isDivergent = result.firstDivergentSample != FlightDataRecorderDiff::NO_DIVERGENCE;
+    numberOfDivergentFields += isDivergent ? 1 : 0;
+    if (!isDivergent && !printAllFields) {
+      continue;
+    }
+    cout << field.before.path << "," << result.maximumError << "," << result.maximumErrorSample << "," << getTime(result.maximumErrorTime)
+         << ",";
+    if (isDivergent) {
+      cout << result.firstDivergentSample << "," << getTime(result.firstDivergentTime);
+    } else {
+      cout << ",";
+    }
+    cout << "," << result.numberOfDivergentSamples << endl;
+  }
+  if (numberOfBeforeSamples != numberOfAfterSamples) {
+    cout << "Files differ in length (" << numberOfBeforeSamples << " and " << numberOfAfterSamples << " samples)" << endl;
+  }
+  cout << "Compared " << numberOfSamples << " samples of " << fields.size() << " fields, " << numberOfDivergentFields << " fields diverge"
+       << endl;
+
+  return numberOfDivergentFields == 0 && numberOfBeforeSamples == numberOfAfterSamples ? 0 : 1;
+}
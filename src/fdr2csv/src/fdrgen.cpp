@@ -0,0 +1,113 @@
+#include <iostream>
+#include <memory>
+
+#include "CommandLine.hpp"
+#include "FlightDataRecorderFileWriter.h"
+#include "FlightDataRecorderSampleGenerator.h"
+
+using namespace std;
+
+static bool getEncoding(const string& name, FlightDataRecorderFormat::BlockEncoding& encoding) {
+  if (name == "ROWS") {
+    encoding = FlightDataRecorderFormat::BLOCK_ENCODING_ROWS;
+  } else if (name == "COLUMNAR") {
+    encoding = FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR;
+  } else if (name == "SPARSE") {
+    encoding = FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char* argv[]) {
+  // variables for command line parameters
+  string outFilePath;
+  double sizeInMegabytes = 0;
+  double duration = 0;
+  double rate = 30;
+  uint32_t seed = 1;
+  bool isLegacy = false;
+  string encodingName = "COLUMNAR";
+  bool noCompression = false;
+  int32_t level = -1;
+  uint32_t samplesPerBlock = 256;
+  bool oPrintHelp = false;
+
+  // configuration of command line parameters
+  CommandLine args("Generates a fdr file with synthetic samples of a repeating flight profile");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output File");
+  args.addArgument({"-s", "--size"}, &sizeInMegabytes, "Size of the samples before compression in MB (default: 100)");
+  args.addArgument({"-d", "--duration"}, &duration, "Simulation time to generate in seconds instead of a size");
+  args.addArgument({"-r", "--rate"}, &rate, "Samples per second of simulation time (default: 30)");
+  args.addArgument({"-x", "--seed"}, &seed, "Seed of the random values (default: 1)");
+  args.addArgument({"-g", "--legacy"}, &isLegacy, "Write the legacy format instead of blocks");
+  args.addArgument({"-e", "--encoding"}, &encodingName, "Block encoding ROWS, COLUMNAR or SPARSE (default: COLUMNAR)");
+  args.addArgument({"-n", "--no-compression"}, &noCompression, "Write blocks or legacy samples without compression");
+  args.addArgument({"-l", "--level"}, &level, "Compression level 1 to 9 (default: zlib default)");
+  args.addArgument({"-b", "--samples-per-block"}, &samplesPerBlock, "Samples per block");
+  args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
+
+  // parse command line
+  try {
+    args.parse(argc, argv);
+  } catch (runtime_error const& e) {
+    cout << e.what() << endl;
+    return -1;
+  }
+
+  // print help
+  if (oPrintHelp) {
+    args.printHelp();
+    cout << endl;
+    return 0;
+  }
+
+  // check parameters
+  if (outFilePath.empty()) {
+    cout << "Output file parameter missing!" << endl;
+    return 1;
+  }
+  FlightDataRecorderFileWriter::Settings settings = {};
+  settings.formatVersion = isLegacy ? FlightDataRecorderFormat::FORMAT_VERSION_LEGACY : FlightDataRecorderFormat::FORMAT_VERSION;
+  settings.compression = noCompression ? FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE : FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE;
+  settings.level = level;
+  settings.samplesPerBlock = samplesPerBlock;
+  if (!getEncoding(encodingName, settings.encoding)) {
+    cout << "Unknown encoding '" << encodingName << "'!" << endl;
+    return 1;
+  }
+  if (rate <= 0) {
+    cout << "Rate must be positive!" << endl;
+    return 1;
+  }
+
+  // number of samples from the duration or the size
+  uint64_t numberOfSamples;
+  if (duration > 0) {
+    numberOfSamples = static_cast<uint64_t>(duration * rate);
+  } else {
+    numberOfSamples = static_cast<uint64_t>((sizeInMegabytes > 0 ? sizeInMegabytes : 100) * 1e6 / sizeof(FlightDataRecorderSample));
+  }
+
+  // generate and write
+  FlightDataRecorderFileWriter writer;
+  if (!writer.open(outFilePath, settings)) {
+    cout << "Failed to create output file!" << endl;
+    return 1;
+  }
+  FlightDataRecorderSampleGenerator generator(seed, rate);
+  auto sample = make_unique<FlightDataRecorderSample>();
+  for (uint64_t i = 0; i < numberOfSamples; i++) {
+    generator.next(*sample);
+    writer.write(*sample);
+  }
+  if (!writer.close()) {
+    cout << "Failed to write output file!" << endl;
+    return 1;
+  }
+
+  cout << "Generated " << numberOfSamples << " samples (" << numberOfSamples * sizeof(FlightDataRecorderSample) << " bytes) into "
+       << writer.getBytesWritten() << " bytes" << endl;
+  return 0;
+}
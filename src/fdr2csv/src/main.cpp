@@ -1,5 +1,16 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
 
 #include "AutopilotLaws_types.h"
 #include "AutopilotStateMachine_types.h"
@@ -7,33 +18,618 @@
 #include "CommandLine.hpp"
 #include "EngineData.h"
 #include "FlightDataRecorder.h"
+#include "FlightDataRecorderColumnExport.h"
 #include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderEventLog.h"
+#include "FlightDataRecorderFieldStatistics.h"
+#include "FlightDataRecorderLayoutMapping.h"
+#include "FlightDataRecorderPipeline.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderResampler.h"
 #include "FlyByWire_types.h"
-#include "zfstream.h"
 
 using namespace std;
 
-// IMPORTANT: this constant needs to increased with every interface change
-const uint64_t INTERFACE_VERSION = 10;
+// window of samples to convert
+struct Window {
+  double from;
+  double to;
+  bool isBySample;
+};
+
+static void setWindow(FlightDataRecorderReader& reader, const Window& window) {
+  if (window.isBySample) {
+    reader.setSampleWindow(static_cast<uint64_t>(max(window.from, 0.0)), static_cast<uint64_t>(min(window.to, 1.8e19)));
+  } else {
+    reader.setSimulationTimeWindow(window.from, window.to);
+  }
+}
+
+// upper bound of the number of samples in the window, taken from the block index or counted by a second reader
+static bool countSamples(FlightDataRecorderReader& reader,
+                         const string& filePath,
+                         bool isCompressed,
+                         const Window& window,
+                         uint64_t& numberOfSamples) {
+  numberOfSamples = 0;
+  auto isWindowed = window.from > -numeric_limits<double>::infinity() || window.to < numeric_limits<double>::infinity();
+  if (reader.getFormatVersion() != FlightDataRecorderFormat::FORMAT_VERSION_LEGACY && !isWindowed) {
+    for (const auto& entry : reader.getIndex()) {
+      numberOfSamples += entry.sampleCount;
+    }
+    return true;
+  }
+
+  // use a second reader to keep the position of the first one, blocks outside of the window are skipped
+  FlightDataRecorderReader counter;
+  if (!counter.open(filePath, isCompressed)) {
+    return false;
+  }
+  setWindow(counter, window);
+  FlightDataRecorderReader::Chunk chunk;
+  while (counter.readChunk(chunk, 4096)) {
+    numberOfSamples += chunk.header.sampleCount;
+  }
+  return true;
+}
+
+// fields of the schema matching a comma separated list of patterns, in the order of the patterns and each field once
+static bool findFields(const vector<FlightDataRecorderSchema::Field>& schema,
+                       const string& fieldList,
+                       vector<FlightDataRecorderSchema::Field>& fields,
+                       string& error) {
+  stringstream fieldStream(fieldList);
+  string pattern;
+  while (getline(fieldStream, pattern, ',')) {
+    auto isMatched = false;
+    for (const auto& field : schema) {
+      if (FlightDataRecorderSchema::matches(pattern, field.path)) {
+        isMatched = true;
+        if (FlightDataRecorderSchema::find(fields, field.path) == nullptr) {
+          fields.push_back(field);
+        }
+      }
+    }
+    if (!isMatched) {
+      error = "Unknown field '" + pattern + "'!";
+      return false;
+    }
+  }
+  return true;
+}
+
+// decodes the blocks of the reader one after the other on the calling thread, for output that depends on the order
+// of the samples
+static bool readBlocks(FlightDataRecorderReader& reader, const function<void(const unsigned char*, size_t)>& consumer, string& error) {
+  FlightDataRecorderReader::Chunk chunk;
+  vector<unsigned char> buffer;
+  while (reader.readChunk(chunk, 4096)) {
+    const unsigned char* samples = nullptr;
+    size_t numberOfSamples = 0;
+    if (!reader.decodeChunk(chunk, buffer, samples, numberOfSamples, error)) {
+      return false;
+    }
+    consumer(samples, numberOfSamples);
+  }
+  error = reader.getError();
+  return error.empty();
+}
+
+// buffer of csv output files
+static constexpr size_t OUTPUT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+// settings of a conversion shared by all files
+struct Options {
+  string delimiter;
+  string fieldList;
+  Window window;
+  bool columnarOutput;
+  bool eventOutput;
+  string contextFieldList;
+  double rate;
+  string holdFieldList;
+  bool hasAggregates;
+  bool currentLayout;
+  bool noCompression;
+};
+
+// outcome of the conversion of one file
+struct Result {
+  uint64_t numberOfSamples = 0;
+  uint64_t bytesIn = 0;
+  uint64_t bytesOut = 0;
+  double seconds = 0;
+  string error;
+};
+
+// converts one file, information and progress are printed if verbose
+static bool convertFile(const Options& options,
+                        const string& inFilePath,
+                        const string& outFilePath,
+                        uint32_t numberOfJobs,
+                        bool isVerbose,
+                        Result& result) {
+  auto start = chrono::steady_clock::now();
+
+  // create reader, it detects the file format
+  FlightDataRecorderReader reader;
+  if (!reader.open(inFilePath, !options.noCompression)) {
+    result.error = reader.getError();
+    return false;
+  }
+
+  // get file version
+  uint64_t fileFormatVersion = reader.getInterfaceVersion();
+
+  // files of other interface versions are converted using their schema or mapped onto the compiled layout
+  bool useSchema = !options.fieldList.empty() || options.columnarOutput;
+  unique_ptr<FlightDataRecorderLayoutMapping> mapping;
+  if (FlightDataRecorder::INTERFACE_VERSION != fileFormatVersion || reader.getSampleSize() != sizeof(FlightDataRecorderSample)) {
+    if (!reader.hasLayout()) {
+      result.error = "ERROR: mismatch between converter and file version ( " + to_string(FlightDataRecorder::INTERFACE_VERSION) +
+                     " <> " + to_string(fileFormatVersion) + " )";
+      return false;
+    }
+    if (options.currentLayout) {
+      mapping = make_unique<FlightDataRecorderLayoutMapping>(reader.getSchema(), reader.getSampleSize(), FlightDataRecorderSchema::getFields(),
+                                                             static_cast<uint32_t>(sizeof(FlightDataRecorderSample)));
+      if (isVerbose) {
+        cerr << "Interface version of file differs from converter, mapping onto the layout of the converter (" << mapping->getNumberOfMissingFields()
+             << " fields missing, " << mapping->getNumberOfDroppedFields() << " fields dropped)" << endl;
+      }
+    } else {
+      if (isVerbose) {
+        cerr << "Interface version of file differs from converter, using schema of file" << endl;
+      }
+      useSchema = true;
+    }
+  }
+
+  // layout of the samples passed on for output, mapped samples are decoded in the layout of the file
+  const auto& schema = mapping != nullptr ? FlightDataRecorderSchema::getFields() : reader.getSchema();
+  auto sampleSize = mapping != nullptr ? mapping->getTargetSampleSize() : reader.getSampleSize();
+  auto selectFields = [&reader, &mapping](const vector<FlightDataRecorderSchema::Field>& selectedFields) {
+    vector<FlightDataRecorderSchema::Field> fileFields;
+    for (const auto& field : selectedFields) {
+      auto fileField = mapping != nullptr ? FlightDataRecorderSchema::find(reader.getSchema(), field.path) : &field;
+      if (fileField != nullptr) {
+        fileFields.push_back(*fileField);
+      }
+    }
+    reader.selectFields(fileFields);
+  };
+  auto mapSamples = [&mapping](const unsigned char*& samples, size_t numberOfSamples) {
+    if (mapping != nullptr) {
+      static thread_local vector<unsigned char> buffer;
+      mapping->map(samples, numberOfSamples, buffer);
+      samples = buffer.data();
+    }
+  };
+
+  // select fields to convert, events are taken from the watched fields and only these and the context are decoded
+  vector<FlightDataRecorderSchema::Field> fields;
+  vector<FlightDataRecorderSchema::Field> contextFields;
+  if (options.eventOutput) {
+    auto fieldList = options.fieldList.empty() ? FlightDataRecorderEventLog::DEFAULT_FIELDS : options.fieldList;
+    auto contextFieldList = options.contextFieldList.empty() ? FlightDataRecorderEventLog::DEFAULT_CONTEXT_FIELDS : options.contextFieldList;
+    if (!findFields(schema, fieldList, fields, result.error) || !findFields(schema, contextFieldList, contextFields, result.error)) {
+      return false;
+    }
+    auto selectedFields = fields;
+    selectedFields.insert(selectedFields.end(), contextFields.begin(), contextFields.end());
+    selectFields(selectedFields);
+  } else if (useSchema) {
+    if (options.fieldList.empty()) {
+      fields = schema;
+    } else {
+      if (!findFields(schema, options.fieldList, fields, result.error)) {
+        return false;
+      }
+      // fields that are not written are not decoded
+      selectFields(fields);
+    }
+  }
+
+  // restrict conversion to the window, blocks outside of it are skipped
+  setWindow(reader, options.window);
+
+  // print information on convert
+  if (isVerbose) {
+    cerr << "Convert from '" << inFilePath;
+    cerr << "' to '" << outFilePath;
+    cerr << "' using interface version '" << fileFormatVersion << "'";
+    cerr << ", file format version '" << reader.getFormatVersion() << "'";
+    cerr << " and delimiter '" << options.delimiter << "'" << endl;
+  }
+
+  // print progress to stderr, stdout may carry the output; bytes are counted on the input as it may be compressed
+  auto progress = [&result, &reader, isVerbose](uint64_t numberOfSamples) {
+    result.numberOfSamples = numberOfSamples;
+    if (isVerbose) {
+      cerr << "Processed " << numberOfSamples << " entries (" << reader.getBytesRead() / 1024 << " KiB read)...";
+      // return to line start
+      cerr << "\r";
+    }
+  };
+
+  // read, format and write blocks of samples in parallel
+  FlightDataRecorderPipeline pipeline(reader, numberOfJobs);
+  bool isOk;
+  string readError;
+  string outputError;
+  if (options.columnarOutput) {
+    // columns are placed in the file according to the number of samples, this needs files on both sides
+    if (inFilePath == "-" || outFilePath == "-") {
+      result.error = "Columnar output cannot be used with stdin or stdout!";
+      return false;
+    }
+
+    // columns are laid out for the number of samples in the file
+    uint64_t numberOfSamples;
+    if (!countSamples(reader, inFilePath, !options.noCompression, options.window, numberOfSamples)) {
+      result.error = "Failed to count samples of input file!";
+      return false;
+    }
+    FlightDataRecorderColumnExport columnExport;
+    if (!columnExport.open(outFilePath, fields, numberOfSamples, mapping != nullptr ? FlightDataRecorder::INTERFACE_VERSION : fileFormatVersion)) {
+      result.error = columnExport.getError();
+      return false;
+    }
+
+    auto formatter = [&fields, sampleSize, &mapSamples](string& buffer, const unsigned char* samples, size_t numberOfSamples) {
+      mapSamples(samples, numberOfSamples);
+      FlightDataRecorderColumnExport::transpose(buffer, fields, sampleSize, samples, numberOfSamples);
+    };
+    auto writer = [&columnExport](const string& buffer, size_t numberOfSamples) {
+      return columnExport.write(buffer, numberOfSamples);
+    };
+    isOk = pipeline.run(formatter, writer, progress);
+    readError = pipeline.getError();
+
+    // the schema is written in any case and describes the samples written
+    if (!columnExport.close()) {
+      outputError = columnExport.getError();
+    }
+  } else {
+    // output stream with a large buffer, "-" is stdout
+    static thread_local vector<char> outBuffer(OUTPUT_BUFFER_SIZE);
+    ofstream outFile;
+    if (outFilePath != "-") {
+      outFile.rdbuf()->pubsetbuf(outBuffer.data(), static_cast<streamsize>(outBuffer.size()));
+      // open the output file
+      outFile.open(outFilePath, ios::out | ios::trunc);
+      // check if file is open
+      if (!outFile.is_open()) {
+        result.error = "Failed to create output file!";
+        return false;
+      }
+    }
+    if (outFilePath == "-") {
+      setvbuf(stdout, nullptr, _IOFBF, OUTPUT_BUFFER_SIZE);
+    }
+    ostream& out = outFilePath == "-" ? cout : outFile;
+
+    if (options.eventOutput) {
+      // blocks are compared in the order of the file, so they are decoded on this thread
+      FlightDataRecorderEventLog eventLog(fields, contextFields, FlightDataRecorderSchema::find(schema, "ap_sm.time.simulation_time"),
+                                          options.delimiter);
+      string buffer;
+      eventLog.writeHeader(buffer);
+      uint64_t numberOfSamples = 0;
+      isOk = readBlocks(
+          reader,
+          [&](const unsigned char* samples, size_t numberOfBlockSamples) {
+            mapSamples(samples, numberOfBlockSamples);
+            eventLog.add(buffer, samples, numberOfBlockSamples, sampleSize);
+            out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+            result.bytesOut += buffer.size();
+            buffer.clear();
+            numberOfSamples += numberOfBlockSamples;
+            progress(numberOfSamples);
+          },
+          readError);
+    } else if (options.rate > 0) {
+      // samples are interpolated with their neighbours, so the blocks are resampled on this thread as well
+      auto simulationTimeField = FlightDataRecorderSchema::find(schema, "ap_sm.time.simulation_time");
+      if (simulationTimeField == nullptr || simulationTimeField->type != FlightDataRecorderSchema::FIELD_TYPE_REAL) {
+        result.error = "Input file has no simulation time to resample!";
+        return false;
+      }
+      auto columns = useSchema ? FlightDataRecorderConverter::getColumns(fields) : FlightDataRecorderConverter::getLegacyColumns();
+      FlightDataRecorderResampler resampler(columns, *simulationTimeField, sampleSize, options.rate, options.holdFieldList,
+                                            options.hasAggregates);
+      ostringstream header;
+      FlightDataRecorderConverter::writeHeader(header, options.delimiter, resampler.getColumns());
+      out << header.str();
+      result.bytesOut += header.str().size();
+
+      string buffer;
+      uint64_t numberOfSamples = 0;
+      isOk = readBlocks(
+          reader,
+          [&](const unsigned char* samples, size_t numberOfBlockSamples) {
+            mapSamples(samples, numberOfBlockSamples);
+            resampler.add(buffer, options.delimiter, samples, numberOfBlockSamples);
+            out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+            result.bytesOut += buffer.size();
+            buffer.clear();
+            numberOfSamples += numberOfBlockSamples;
+            progress(numberOfSamples);
+          },
+          readError);
+    } else {
+      // write header
+      auto columns = useSchema ? FlightDataRecorderConverter::getColumns(fields) : FlightDataRecorderConverter::getLegacyColumns();
+      ostringstream header;
+      FlightDataRecorderConverter::writeHeader(header, options.delimiter, columns);
+      out << header.str();
+      result.bytesOut += header.str().size();
+
+      // format and write whole blocks
+      auto formatter = [&options, &columns, sampleSize, &mapSamples](string& buffer, const unsigned char* samples, size_t numberOfSamples) {
+        mapSamples(samples, numberOfSamples);
+        for (size_t i = 0; i < numberOfSamples; i++) {
+          FlightDataRecorderConverter::writeSample(buffer, options.delimiter, columns, samples + i * sampleSize);
+        }
+      };
+      auto writer = [&out, &result](const string& buffer, size_t) {
+        out.write(buffer.data(), static_cast<streamsize>(buffer.size()));
+        result.bytesOut += buffer.size();
+        return static_cast<bool>(out);
+      };
+      isOk = pipeline.run(formatter, writer, progress);
+      readError = pipeline.getError();
+    }
+    out.flush();
+    if (!out) {
+      outputError = "Failed to write output!";
+    }
+  }
+
+  // print final value
+  if (isVerbose) {
+    cerr << "Processed " << result.numberOfSamples << " entries." << endl;
+  }
+
+  // size and duration for the summary
+  result.bytesIn = reader.getBytesRead();
+  if (options.columnarOutput) {
+    error_code errorCode;
+    result.bytesOut = filesystem::file_size(outFilePath, errorCode);
+  }
+  result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // check if file was read completely
+  if (!isOk) {
+    result.error = "ERROR: " + readError;
+    return false;
+  }
+  if (!outputError.empty()) {
+    result.error = "ERROR: " + outputError;
+    return false;
+  }
+  return true;
+}
+
+// computes the statistics of the selected fields of one file in a single pass without formatting any sample
+static bool analyzeFile(const Options& options, const string& inFilePath, vector<FlightDataRecorderFieldStatistics>& statistics, Result& result) {
+  auto start = chrono::steady_clock::now();
+
+  FlightDataRecorderReader reader;
+  if (!reader.open(inFilePath, !options.noCompression)) {
+    result.error = reader.getError();
+    return false;
+  }
+
+  // every field of the schema is a statistics column, the compiled legacy csv layout is not needed
+  vector<FlightDataRecorderSchema::Field> fields;
+  if (options.fieldList.empty()) {
+    fields = reader.getSchema();
+  } else {
+    if (!findFields(reader.getSchema(), options.fieldList, fields, result.error)) {
+      return false;
+    }
+    reader.selectFields(fields);
+  }
+  setWindow(reader, options.window);
+
+  statistics.clear();
+  for (const auto& field : fields) {
+    statistics.emplace_back(field);
+  }
+
+  // blocks are decoded in place and added field by field
+  auto isOk = readBlocks(
+      reader,
+      [&](const unsigned char* samples, size_t numberOfSamples) {
+        for (auto& fieldStatistics : statistics) {
+          fieldStatistics.add(samples, numberOfSamples, reader.getSampleSize());
+        }
+        result.numberOfSamples += numberOfSamples;
+      },
+      result.error);
+
+  result.bytesIn = reader.getBytesRead();
+  result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+  return isOk;
+}
+
+// analyzes the files concurrently and prints one csv row per file and field, each file is analyzed by one thread
+static int analyzeFiles(const Options& options, const vector<string>& files, uint32_t numberOfJobs) {
+  static const vector<pair<const char*, double>> QUANTILES = {{"p1", 0.01}, {"p5", 0.05}, {"p50", 0.5}, {"p95", 0.95}, {"p99", 0.99}};
+
+  vector<vector<FlightDataRecorderFieldStatistics>> statistics(files.size());
+  vector<Result> results(files.size());
+  atomic<size_t> nextFile = 0;
+  auto work = [&]() {
+    for (auto i = nextFile++; i < files.size(); i = nextFile++) {
+      analyzeFile(options, files[i], statistics[i], results[i]);
+    }
+  };
+  vector<thread> workers;
+  for (size_t i = 0; i < min<size_t>(max(numberOfJobs, 1u), files.size()); i++) {
+    workers.emplace_back(work);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  // print report, fields without values have empty columns
+  cout << "file,field,count,min,max,mean,stddev";
+  for (const auto& quantile : QUANTILES) {
+    cout << "," << quantile.first;
+  }
+  cout << endl;
+  size_t numberOfFailures = 0;
+  for (size_t i = 0; i < files.size(); i++) {
+    auto fileName = files[i] == "-" ? files[i] : filesystem::path(files[i]).filename().string();
+    if (!results[i].error.empty()) {
+      cerr << "Failed '" << files[i] << "': " << results[i].error << endl;
+      numberOfFailures++;
+      continue;
+    }
+    for (const auto& fieldStatistics : statistics[i]) {
+      cout << fileName << "," << fieldStatistics.getField().path << "," << fieldStatistics.getCount();
+      if (fieldStatistics.getCount() == 0) {
+        cout << string(4 + QUANTILES.size(), ',') << "\n";
+        continue;
+      }
+      cout << "," << fieldStatistics.getMinimum() << "," << fieldStatistics.getMaximum() << "," << fieldStatistics.getMean() << ","
+           << fieldStatistics.getStandardDeviation();
+      for (const auto& quantile : QUANTILES) {
+        cout << "," << fieldStatistics.getQuantile(quantile.second);
+      }
+      cout << "\n";
+    }
+  }
+  cout.flush();
+
+  return numberOfFailures == 0 ? 0 : 1;
+}
+
+// files of a directory or of a file name pattern like flights/*.fdr, sorted by name
+static vector<filesystem::path> findInputFiles(const string& inPath) {
+  vector<filesystem::path> files;
+  filesystem::path directory = inPath;
+  string pattern = "*.fdr";
+  if (!filesystem::is_directory(directory)) {
+    pattern = directory.filename().string();
+    directory = directory.has_parent_path() ? directory.parent_path() : filesystem::path(".");
+  }
+
+  error_code errorCode;
+  for (const auto& entry : filesystem::directory_iterator(directory, errorCode)) {
+    if (entry.is_regular_file() && FlightDataRecorderSchema::matches(pattern, entry.path().filename().string())) {
+      files.push_back(entry.path());
+    }
+  }
+  sort(files.begin(), files.end());
+  return files;
+}
+
+// converts several files concurrently into the output directory, each file is converted by one thread
+static int convertFiles(const Options& options, const string& inPath, const string& outDirectory, uint32_t numberOfJobs) {
+  auto files = findInputFiles(inPath);
+  if (files.empty()) {
+    cout << "No input files found!" << endl;
+    return 1;
+  }
+  error_code errorCode;
+  filesystem::create_directories(outDirectory, errorCode);
+  if (!filesystem::is_directory(outDirectory)) {
+    cout << "Failed to create output directory!" << endl;
+    return 1;
+  }
+
+  cout << "Convert " << files.size() << " files to '" << outDirectory << "' using " << numberOfJobs << " threads" << endl;
+
+  // output file has the name of the input file with the extension of the output format
+  vector<Result> results(files.size());
+  atomic<size_t> nextFile = 0;
+  mutex outputMutex;
+  auto start = chrono::steady_clock::now();
+  auto work = [&]() {
+    for (auto i = nextFile++; i < files.size(); i = nextFile++) {
+      auto outFilePath = filesystem::path(outDirectory) / files[i].filename().replace_extension(options.columnarOutput ? ".bin" : ".csv");
+      convertFile(options, files[i].string(), outFilePath.string(), 1, false, results[i]);
+      lock_guard<mutex> lock(outputMutex);
+      cout << (results[i].error.empty() ? "Converted '" : "Failed '") << files[i].string() << "'" << endl;
+    }
+  };
+  vector<thread> workers;
+  for (size_t i = 0; i < min<size_t>(max(numberOfJobs, 1u), files.size()); i++) {
+    workers.emplace_back(work);
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  // print summary
+  cout << "file,entries,bytes_in,bytes_out,seconds,error" << endl;
+  Result total;
+  size_t numberOfFailures = 0;
+  for (size_t i = 0; i < files.size(); i++) {
+    const auto& result = results[i];
+    cout << files[i].filename().string() << "," << result.numberOfSamples << "," << result.bytesIn << "," << result.bytesOut << ",";
+    cout << result.seconds << "," << result.error << endl;
+    total.numberOfSamples += result.numberOfSamples;
+    total.bytesIn += result.bytesIn;
+    total.bytesOut += result.bytesOut;
+    numberOfFailures += result.error.empty() ? 0 : 1;
+  }
+  cout << "Converted " << files.size() - numberOfFailures << " of " << files.size() << " files with " << total.numberOfSamples
+       << " entries (" << total.bytesIn << " bytes in, " << total.bytesOut << " bytes out) in " << seconds << " s" << endl;
+
+  return numberOfFailures == 0 ? 0 : 1;
+}
 
 int main(int argc, char* argv[]) {
   // variables for command line parameters
   string inFilePath;
   string outFilePath;
   string delimiter = ",";
+  string fieldList;
+  uint32_t numberOfJobs = max(thread::hardware_concurrency(), 1u);
+  Window window = {-numeric_limits<double>::infinity(), numeric_limits<double>::infinity(), false};
+  bool columnarOutput = false;
+  bool eventOutput = false;
+  string contextFieldList;
+  double rate = 0;
+  string holdFieldList;
+  bool hasAggregates = false;
+  bool currentLayout = false;
+  bool printFieldStatistics = false;
   bool noCompression = false;
   bool printStructSize = false;
   bool printGetFileInterfaceVersion = false;
+  bool printIndex = false;
+  bool printRecorderStatistics = false;
   bool oPrintHelp = false;
 
   // configuration of command line parameters
   CommandLine args("Converts a32nx fdr files to csv");
-  args.addArgument({"-i", "--in"}, &inFilePath, "Input File");
-  args.addArgument({"-o", "--out"}, &outFilePath, "Output File");
+  args.addArgument({"-i", "--in"}, &inFilePath, "Input File (- for stdin), directory or pattern like flights/*.fdr");
+  args.addArgument({"-o", "--out"}, &outFilePath, "Output File (- for stdout), directory if several files are converted");
   args.addArgument({"-d", "--delimiter"}, &delimiter, "Delimiter");
+  args.addArgument({"-f", "--fields"}, &fieldList, "Comma separated list of fields or patterns like fbw.sim.data.* to convert (default: all)");
+  args.addArgument({"-j", "--jobs"}, &numberOfJobs, "Number of threads, files converted at once for several files (default: number of cores)");
+  args.addArgument({"-s", "--from"}, &window.from, "Convert samples from this simulation time on (inclusive)");
+  args.addArgument({"-e", "--to"}, &window.to, "Convert samples up to this simulation time (inclusive)");
+  args.addArgument({"-w", "--window-by-sample"}, &window.isBySample, "Interpret --from and --to as sample index");
+  args.addArgument({"-c", "--columnar"}, &columnarOutput, "Write a binary file with one array per field and a json schema (<out>.json)");
+  args.addArgument({"-m", "--events"}, &eventOutput, "Write transitions of --fields (default: AP, A/THR modes and protections) as csv");
+  args.addArgument({"-k", "--context"}, &contextFieldList, "Comma separated list of fields or patterns written with each event");
+  args.addArgument({"-q", "--rate"}, &rate, "Resample to this rate in Hz on a grid of the simulation time (default: off)");
+  args.addArgument({"-l", "--hold"}, &holdFieldList, "Real fields or patterns held at their last value when resampling instead of interpolated");
+  args.addArgument({"-a", "--aggregate"}, &hasAggregates, "Add min, max and mean of each interval to interpolated fields when resampling");
+  args.addArgument({"-u", "--current-layout"}, &currentLayout, "Convert files of other interface versions to the layout of the converter, missing fields are 0");
+  args.addArgument({"-t", "--stats"}, &printFieldStatistics, "Print min, max, mean, stddev and percentiles per field as csv instead of converting");
   args.addArgument({"-n", "--no-compression"}, &noCompression, "Input file is not compressed");
   args.addArgument({"-p", "--print-struct-size"}, &printStructSize, "Print struct size");
   args.addArgument({"-g", "--get-input-file-version"}, &printGetFileInterfaceVersion, "Print interface version of input file");
+  args.addArgument({"-x", "--print-index"}, &printIndex, "Print block index of input file");
+  args.addArgument({"-r", "--print-recorder-statistics"}, &printRecorderStatistics, "Print recorder statistics of input file");
   args.addArgument({"-h", "--help"}, &oPrintHelp, "Print help message");
 
   // parse command line
@@ -61,94 +657,92 @@ int main(int argc, char* argv[]) {
     cout << "Input file parameter missing!" << endl;
     return 1;
   }
-  if (!filesystem::exists(inFilePath)) {
+  if (inFilePath != "-" && !filesystem::exists(inFilePath) && inFilePath.find_first_of("*?") == string::npos) {
     cout << "Input file does not exist!" << endl;
     return 1;
   }
-  if (outFilePath.empty() && !printGetFileInterfaceVersion) {
+  if (outFilePath.empty() && !printFieldStatistics && !printGetFileInterfaceVersion && !printIndex && !printRecorderStatistics) {
     cout << "Output file parameter missing!" << endl;
     return 1;
   }
 
-  // create input stream
-  istream* in;
-  if (!noCompression) {
-    in = new gzifstream(inFilePath.c_str());
-  } else {
-    in = new ifstream(inFilePath.c_str(), ios::in | ios::binary);
+  if (columnarOutput && (eventOutput || rate > 0)) {
+    cout << "Events and resampled samples cannot be written as columnar file!" << endl;
+    return 1;
   }
 
-  // check if stream is ok
-  if (!in->good()) {
-    cout << "Failed to open input file!" << endl;
-    return 1;
+  // several files are converted into a directory
+  Options options = {delimiter, fieldList, window, columnarOutput, eventOutput, contextFieldList, rate, holdFieldList, hasAggregates, currentLayout,
+                     noCompression};
+  auto isBatch = filesystem::is_directory(inFilePath) || inFilePath.find_first_of("*?") != string::npos;
+
+  // statistics are printed instead of converting, several files are analyzed at once
+  if (printFieldStatistics) {
+    vector<string> files = {inFilePath};
+    if (isBatch) {
+      files.clear();
+      for (const auto& file : findInputFiles(inFilePath)) {
+        files.push_back(file.string());
+      }
+      if (files.empty()) {
+        cout << "No input files found!" << endl;
+        return 1;
+      }
+    }
+    return analyzeFiles(options, files, numberOfJobs);
   }
 
-  // read file version
-  uint64_t fileFormatVersion = {};
-  in->read(reinterpret_cast<char*>(&fileFormatVersion), sizeof(INTERFACE_VERSION));
+  if (isBatch) {
+    return convertFiles(options, inFilePath, outFilePath, numberOfJobs);
+  }
 
-  // print file version if requested and return
-  if (printGetFileInterfaceVersion) {
-    cout << fileFormatVersion << endl;
+  // convert single file, the input may be a stream that can only be read once
+  if (!printGetFileInterfaceVersion && !printIndex && !printRecorderStatistics) {
+    Result result;
+    if (!convertFile(options, inFilePath, outFilePath, numberOfJobs, true, result)) {
+      cerr << result.error << endl;
+      return 1;
+    }
     return 0;
-  } else if (INTERFACE_VERSION != fileFormatVersion) {
-    cout << "ERROR: mismatch between converter and file version ( ";
-    cout << INTERFACE_VERSION;
-    cout << " <> " << fileFormatVersion << " )" << endl;
-    return 1;
   }
 
-  // print information on convert
-  cout << "Convert from '" << inFilePath;
-  cout << "' to '" << outFilePath;
-  cout << "' using interface version '" << fileFormatVersion << "'";
-  cout << " and delimiter '" << delimiter << "'" << endl;
-
-  // output stream
-  ofstream out;
-  // open the output file
-  out.open(outFilePath, ios::out | ios::trunc);
-  // check if file is open
-  if (!out.is_open()) {
-    cout << "Failed to create output file!" << endl;
+  // create reader, it detects the file format
+  FlightDataRecorderReader reader;
+  if (!reader.open(inFilePath, !noCompression)) {
+    cerr << reader.getError() << endl;
     return 1;
   }
 
-  // write header
-  FlightDataRecorderConverter::writeHeader(out, delimiter);
-
-  // calculate number of entries
-  auto counter = 0;
-  auto numberOfEntries = filesystem::file_size(inFilePath) / sizeof(fbw_output);
-
-  // struct for reading
-  ap_sm_output data_ap_sm = {};
-  ap_raw_output data_ap_laws = {};
-  athr_out data_athr = {};
-  fbw_output data_fbw = {};
-  EngineData data_engine = {};
-
-  // read one struct from the file
-  while (!in->eof()) {
-    // read data into structs
-    in->read(reinterpret_cast<char*>(&data_ap_sm), sizeof(ap_sm_output));
-    in->read(reinterpret_cast<char*>(&data_ap_laws), sizeof(ap_raw_output));
-    in->read(reinterpret_cast<char*>(&data_athr), sizeof(athr_out));
-    in->read(reinterpret_cast<char*>(&data_fbw), sizeof(fbw_output));
-    in->read(reinterpret_cast<char*>(&data_engine), sizeof(EngineData));
-    // write struct to csv file
-    FlightDataRecorderConverter::writeStruct(out, delimiter, data_ap_sm, data_ap_laws, data_athr, data_fbw, data_engine);
-    // print progress
-    if (++counter % 500 == 0) {
-      cout << "Processed " << counter << " entries...";
-      // return to line start
-      cout << "\r";
+  // print file version if requested and return
+  if (printGetFileInterfaceVersion) {
+    cout << reader.getInterfaceVersion() << endl;
+    return 0;
+  }
+
+  // print block index if requested and return
+  if (printIndex) {
+    if (reader.getFormatVersion() == FlightDataRecorderFormat::FORMAT_VERSION_LEGACY) {
+      cout << "Legacy file format has no block index!" << endl;
+      return 1;
+    }
+    cout << "block,offset,first_sample,sample_count,first_simulation_time,last_simulation_time" << endl;
+    auto& index = reader.getIndex();
+    for (size_t i = 0; i < index.size(); i++) {
+      cout << i << "," << index[i].offset << "," << index[i].firstSampleIndex << "," << index[i].sampleCount << ",";
+      cout << index[i].firstSimulationTime << "," << index[i].lastSimulationTime << endl;
     }
+    return 0;
   }
 
-  // print final value
-  cout << "Processed " << counter << " entries." << endl;
+  // print recorder statistics if requested and return
+  if (printRecorderStatistics) {
+    FlightDataRecorderFormat::Statistics statistics;
+    if (!reader.getStatistics(statistics)) {
+      cout << "Input file contains no recorder statistics!" << endl;
+      return 1;
+    }
+    FlightDataRecorderStatistics::print(cout, "", statistics);
+  }
 
   // success
   return 0;
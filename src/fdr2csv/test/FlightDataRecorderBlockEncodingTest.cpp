@@ -0,0 +1,85 @@
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+#include "FlightDataRecorderFileWriter.h"
+#include "FlightDataRecorderReader.h"
+#include "FlightDataRecorderSampleGenerator.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+// two full blocks and a partial one
+static constexpr size_t NUMBER_OF_SAMPLES = 700;
+static constexpr uint32_t SAMPLES_PER_BLOCK = 256;
+
+static void checkRoundTrip(const vector<FlightDataRecorderSample>& samples,
+                           FlightDataRecorderFormat::BlockEncoding encoding,
+                           FlightDataRecorderFormat::BlockCompression compression) {
+  auto filePath = (filesystem::temp_directory_path() / ("FlightDataRecorderBlockEncodingTest-" + to_string(encoding) + "-" +
+                                                        to_string(compression) + ".fdr"))
+                      .string();
+  cout << "encoding " << encoding << ", compression " << compression << endl;
+
+  // write
+  FlightDataRecorderFileWriter writer;
+  FlightDataRecorderFileWriter::Settings settings = {FlightDataRecorderFormat::FORMAT_VERSION, encoding, compression, -1,
+                                                     SAMPLES_PER_BLOCK};
+  FDR_CHECK(writer.open(filePath, settings));
+  for (const auto& sample : samples) {
+    writer.write(sample);
+  }
+  FDR_CHECK(writer.close());
+
+  // the index covers all samples
+  FlightDataRecorderReader reader;
+  FDR_CHECK(reader.open(filePath, true));
+  FDR_CHECK(reader.hasFileSchema());
+  const auto& index = reader.getIndex();
+  FDR_CHECK_EQUAL(index.size(), (NUMBER_OF_SAMPLES + SAMPLES_PER_BLOCK - 1) / SAMPLES_PER_BLOCK);
+  uint64_t indexedSamples = 0;
+  for (const auto& entry : index) {
+    FDR_CHECK_EQUAL(entry.firstSampleIndex, indexedSamples);
+    indexedSamples += entry.sampleCount;
+  }
+  FDR_CHECK_EQUAL(indexedSamples, NUMBER_OF_SAMPLES);
+
+  // every field comes back bit exact, padding between fields is not part of the encodings
+  auto sample = make_unique<FlightDataRecorderSample>();
+  const auto& fields = FlightDataRecorderSchema::getFields();
+  for (size_t i = 0; i < samples.size(); i++) {
+    FDR_CHECK(reader.read(*sample));
+    auto expected = reinterpret_cast<const unsigned char*>(&samples[i]);
+    auto actual = reinterpret_cast<const unsigned char*>(sample.get());
+    for (const auto& field : fields) {
+      if (memcmp(expected + field.offset, actual + field.offset, field.size) != 0) {
+        cerr << "sample " << i << " field " << field.path << " = " << FlightDataRecorderSchema::getValue(field, actual) << ", expected "
+             << FlightDataRecorderSchema::getValue(field, expected) << endl;
+        FDR_CHECK(false);
+      }
+    }
+  }
+  FDR_CHECK(!reader.read(*sample));
+  FDR_CHECK(reader.getError().empty());
+
+  filesystem::remove(filePath);
+}
+
+int main() {
+  // samples of the generator cover constant, smooth, noisy and discrete fields
+  vector<FlightDataRecorderSample> samples(NUMBER_OF_SAMPLES);
+  FlightDataRecorderSampleGenerator generator(1, 30);
+  for (auto& sample : samples) {
+    generator.next(sample);
+  }
+
+  for (auto encoding : {FlightDataRecorderFormat::BLOCK_ENCODING_ROWS, FlightDataRecorderFormat::BLOCK_ENCODING_COLUMNAR,
+                        FlightDataRecorderFormat::BLOCK_ENCODING_SPARSE}) {
+    for (auto compression : {FlightDataRecorderFormat::BLOCK_COMPRESSION_DEFLATE, FlightDataRecorderFormat::BLOCK_COMPRESSION_NONE}) {
+      checkRoundTrip(samples, encoding, compression);
+    }
+  }
+
+  return 0;
+}
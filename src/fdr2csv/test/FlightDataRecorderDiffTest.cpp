@@ -0,0 +1,51 @@
+#include <cmath>
+#include <limits>
+
+#include "FlightDataRecorderDiff.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+static constexpr double NOT_A_NUMBER = numeric_limits<double>::quiet_NaN();
+static constexpr double INFINITY_VALUE = numeric_limits<double>::infinity();
+
+static FlightDataRecorderDiff::Result compare(const double (&expected)[4], const double (&actual)[4], double relativeTolerance) {
+  static const double SIMULATION_TIMES[] = {0.5, 1.0, 1.5, 2.0};
+  FlightDataRecorderDiff::Result result;
+  FlightDataRecorderDiff::compare(expected, actual, SIMULATION_TIMES, 4, {0.1, relativeTolerance}, 100, result);
+  return result;
+}
+
+int main() {
+  for (auto relativeTolerance : {0.0, 0.01}) {
+    // NaN or infinity only in the reference diverges, like only in the compared file
+    for (auto value : {NOT_A_NUMBER, INFINITY_VALUE, -INFINITY_VALUE}) {
+      auto referenceResult = compare({1, value, 3, value}, {1, 5, 3, 2}, relativeTolerance);
+      FDR_CHECK_EQUAL(referenceResult.numberOfDivergentSamples, 2u);
+      FDR_CHECK_EQUAL(referenceResult.firstDivergentSample, 101u);
+      FDR_CHECK_EQUAL(referenceResult.firstDivergentTime, 1.0);
+      FDR_CHECK(isinf(referenceResult.maximumError));
+      FDR_CHECK_EQUAL(referenceResult.maximumErrorSample, 101u);
+
+      auto comparedResult = compare({1, 5, 3, 2}, {1, value, 3, value}, relativeTolerance);
+      FDR_CHECK_EQUAL(comparedResult.numberOfDivergentSamples, 2u);
+      FDR_CHECK_EQUAL(comparedResult.firstDivergentSample, 101u);
+      FDR_CHECK(isinf(comparedResult.maximumError));
+    }
+
+    // equal special values and errors within the tolerance do not diverge
+    auto equalResult = compare({NOT_A_NUMBER, INFINITY_VALUE, -INFINITY_VALUE, 1}, {NOT_A_NUMBER, INFINITY_VALUE, -INFINITY_VALUE, 1.05},
+                               relativeTolerance);
+    FDR_CHECK_EQUAL(equalResult.numberOfDivergentSamples, 0u);
+    FDR_CHECK_EQUAL(equalResult.firstDivergentSample, FlightDataRecorderDiff::NO_DIVERGENCE);
+    FDR_CHECK_EQUAL(equalResult.maximumErrorSample, 103u);
+    FDR_CHECK_EQUAL(equalResult.maximumErrorTime, 2.0);
+  }
+
+  // infinities of opposite sign diverge
+  auto signResult = compare({INFINITY_VALUE, 0, 0, 0}, {-INFINITY_VALUE, 0, 0, 0}, 0.01);
+  FDR_CHECK_EQUAL(signResult.numberOfDivergentSamples, 1u);
+  FDR_CHECK_EQUAL(signResult.firstDivergentSample, 100u);
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <vector>
+
+#include "FlightDataRecorderFieldStatistics.h"
+#include "FlightDataRecorderSampleGenerator.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+// about 2.4 hours at 30 Hz
+static constexpr size_t NUMBER_OF_SAMPLES = size_t(1) << 18;
+static constexpr size_t NUMBER_OF_CHECKED_FIELDS = 32;
+
+// distance of the quantile from the range of ranks the estimate covers, as a fraction of all values
+static double getRankError(const vector<double>& sortedValues, double estimate, double quantile) {
+  auto n = static_cast<double>(sortedValues.size());
+  auto lower = static_cast<double>(lower_bound(sortedValues.begin(), sortedValues.end(), estimate) - sortedValues.begin()) / n;
+  auto upper = static_cast<double>(upper_bound(sortedValues.begin(), sortedValues.end(), estimate) - sortedValues.begin()) / n;
+  return max({lower - quantile, quantile - upper, 0.0});
+}
+
+int main() {
+  // real fields spread over all recorded structs
+  vector<FlightDataRecorderSchema::Field> fields;
+  for (const auto& field : FlightDataRecorderSchema::getFields()) {
+    if (field.type == FlightDataRecorderSchema::FIELD_TYPE_REAL) {
+      fields.push_back(field);
+    }
+  }
+  auto stride = max(fields.size() / NUMBER_OF_CHECKED_FIELDS, size_t(1));
+  vector<FlightDataRecorderSchema::Field> checkedFields;
+  for (size_t i = 0; i < fields.size(); i += stride) {
+    checkedFields.push_back(fields[i]);
+  }
+
+  // collect exact values next to the sketch
+  vector<FlightDataRecorderFieldStatistics> statistics;
+  vector<vector<double>> values(checkedFields.size());
+  for (size_t i = 0; i < checkedFields.size(); i++) {
+    statistics.emplace_back(checkedFields[i]);
+    values[i].reserve(NUMBER_OF_SAMPLES);
+  }
+  FlightDataRecorderSampleGenerator generator(1, 30);
+  auto sample = make_unique<FlightDataRecorderSample>();
+  for (size_t n = 0; n < NUMBER_OF_SAMPLES; n++) {
+    generator.next(*sample);
+    auto data = reinterpret_cast<const unsigned char*>(sample.get());
+    for (size_t i = 0; i < checkedFields.size(); i++) {
+      auto value = FlightDataRecorderSchema::getValue(checkedFields[i], data);
+      statistics[i].add(value);
+      values[i].push_back(value);
+    }
+  }
+
+  // the observed rank error stays within the bound stated for the sketch
+  auto levelCapacity = static_cast<double>(FlightDataRecorderFieldStatistics::LEVEL_CAPACITY);
+  auto bound = log2(static_cast<double>(NUMBER_OF_SAMPLES) / levelCapacity) / levelCapacity;
+  double maximumError = 0;
+  for (size_t i = 0; i < checkedFields.size(); i++) {
+    sort(values[i].begin(), values[i].end());
+    FDR_CHECK_EQUAL(statistics[i].getMinimum(), values[i].front());
+    FDR_CHECK_EQUAL(statistics[i].getMaximum(), values[i].back());
+    for (auto quantile : {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99}) {
+      maximumError = max(maximumError, getRankError(values[i], statistics[i].getQuantile(quantile), quantile));
+    }
+  }
+  cout << "fields " << checkedFields.size() << ", samples " << NUMBER_OF_SAMPLES << ", maximum rank error " << setprecision(3)
+       << maximumError * 100 << " %, bound " << bound * 100 << " %" << endl;
+  FDR_CHECK(maximumError <= bound);
+
+  return 0;
+}
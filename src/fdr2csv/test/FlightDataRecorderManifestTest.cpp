@@ -0,0 +1,69 @@
+#include <filesystem>
+#include <fstream>
+
+#include "FlightDataRecorderManifest.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+static void createFile(const string& filename) {
+  ofstream(filename) << filename;
+}
+
+int main() {
+  auto workDirectory = filesystem::temp_directory_path() / "FlightDataRecorderManifestTest";
+  filesystem::remove_all(workDirectory);
+  filesystem::create_directories(workDirectory / "empty");
+  filesystem::current_path(workDirectory);
+
+  // a reused name replaces the entry and becomes the newest one
+  FlightDataRecorderManifest manifest;
+  manifest.load("manifest", "empty", ".fdr");
+  FDR_CHECK_EQUAL(manifest.getNumberOfFiles(), 0u);
+  for (auto filename : {"a.fdr", "b.fdr"}) {
+    createFile(filename);
+    manifest.add(filename);
+    manifest.updateNewest(100, 10, 0, 1);
+  }
+  manifest.add("a.fdr");
+  manifest.updateNewest(50, 5, 2, 3);
+  FDR_CHECK(manifest.contains("a.fdr"));
+  FDR_CHECK_EQUAL(manifest.getNumberOfFiles(), 2u);
+  FDR_CHECK_EQUAL(manifest.getTotalSize(), 150u);
+
+  // retention removes the oldest file and keeps the one that reused the name
+  manifest.applyRetention(1, 0);
+  FDR_CHECK_EQUAL(manifest.getNumberOfFiles(), 1u);
+  FDR_CHECK_EQUAL(manifest.getTotalSize(), 50u);
+  FDR_CHECK(!filesystem::exists("b.fdr"));
+  FDR_CHECK(filesystem::exists("a.fdr"));
+
+  // entries survive saving and loading
+  FDR_CHECK(manifest.save());
+  FlightDataRecorderManifest reloaded;
+  reloaded.load("manifest", "empty", ".fdr");
+  FDR_CHECK_EQUAL(reloaded.getNumberOfFiles(), 1u);
+  FDR_CHECK_EQUAL(reloaded.getTotalSize(), 50u);
+
+  // manifests of earlier versions list a reused name twice, the duplicate must not delete the file being written
+  createFile("c.fdr");
+  createFile("d.fdr");
+  ofstream("duplicates") << "100 10 0 1 c.fdr\n100 10 0 1 d.fdr\n100 10 2 3 c.fdr\n";
+  FlightDataRecorderManifest duplicates;
+  duplicates.load("duplicates", "empty", ".fdr");
+  FDR_CHECK_EQUAL(duplicates.getNumberOfFiles(), 2u);
+  FDR_CHECK_EQUAL(duplicates.getTotalSize(), 200u);
+  duplicates.add("c.fdr");
+  duplicates.applyRetention(1, 0);
+  FDR_CHECK_EQUAL(duplicates.getNumberOfFiles(), 1u);
+  FDR_CHECK(!filesystem::exists("d.fdr"));
+  FDR_CHECK(filesystem::exists("c.fdr"));
+
+  // the size limit never removes the newest file
+  duplicates.updateNewest(1000, 100, 0, 10);
+  duplicates.applyRetention(0, 10);
+  FDR_CHECK_EQUAL(duplicates.getNumberOfFiles(), 1u);
+  FDR_CHECK(filesystem::exists("c.fdr"));
+
+  return 0;
+}
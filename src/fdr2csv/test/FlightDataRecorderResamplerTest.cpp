@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "FlightDataRecorderConverter.h"
+#include "FlightDataRecorderResampler.h"
+#include "FlightDataRecorderSample.h"
+#include "FlightDataRecorderSchema.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+// continuous signals stored below a law or mode in their path
+static const char* INTERPOLATED_FIELDS[] = {
+    "ap_law.autopilot.Theta_c_deg",
+    "ap_law.autopilot.Phi_c_deg",
+    "ap_law.flight_director.Beta_c_deg",
+    "ap_law.Phi_loc_c",
+    "fbw.pitch.law_normal.nz_c_g",
+    "fbw.pitch.law_normal.Cstar_g",
+    "fbw.pitch.law_normal.protection_alpha_c_deg",
+    "fbw.pitch.law_rotation.eta_deg",
+    "fbw.roll.law_normal.xi_deg",
+    "fbw.roll.law_normal.zeta_deg",
+};
+
+// modes, laws and flags stored as real values
+static const char* HELD_FIELDS[] = {
+    "ap_sm.output.lateral_law",
+    "ap_sm.output.vertical_law",
+    "ap_sm.output.lateral_mode",
+    "ap_sm.output.vertical_mode_armed",
+    "ap_sm.output.mode_reversion_lateral",
+    "ap_sm.output.enabled_AP1",
+    "ap_sm.output.autothrust_mode",
+    "athr.input.mode_requested",
+    "athr.output.sim_thrust_mode_1",
+    "ap_law.ap_on",
+    "fbw.sim.data_computed.high_aoa_prot_active",
+    "ap_sm.data.nav_dme_valid",
+    "ap_sm.data.flight_phase",
+    "engine.engineEngine1State",
+};
+
+static bool isInterpolated(const vector<FlightDataRecorderConverter::Column>& columns, const string& name) {
+  // interpolated columns are the only ones followed by aggregates
+  return any_of(columns.begin(), columns.end(),
+                [&name](const FlightDataRecorderConverter::Column& column) { return column.name == name + ".min"; });
+}
+
+static const FlightDataRecorderSchema::Field& getField(const string& path) {
+  auto field = FlightDataRecorderSchema::find(FlightDataRecorderSchema::getFields(), path);
+  FDR_CHECK(field != nullptr);
+  return *field;
+}
+
+int main() {
+  const auto& fields = FlightDataRecorderSchema::getFields();
+  const auto& simulationTimeField = getField("ap_sm.time.simulation_time");
+
+  // classification of the default hold patterns over the whole schema
+  FlightDataRecorderResampler resampler(FlightDataRecorderConverter::getColumns(fields), simulationTimeField,
+                                        sizeof(FlightDataRecorderSample), 1, "", true);
+  const auto& columns = resampler.getColumns();
+  for (auto name : INTERPOLATED_FIELDS) {
+    FDR_CHECK(isInterpolated(columns, name));
+  }
+  for (auto name : HELD_FIELDS) {
+    FDR_CHECK(!isInterpolated(columns, name));
+  }
+  for (const auto& field : fields) {
+    if (field.type != FlightDataRecorderSchema::FIELD_TYPE_REAL) {
+      FDR_CHECK(!isInterpolated(columns, field.path));
+    }
+  }
+
+  // values at the grid points between two samples
+  vector<FlightDataRecorderSchema::Field> selection = {simulationTimeField, getField("ap_law.autopilot.Theta_c_deg"),
+                                                       getField("ap_sm.output.lateral_mode"), getField("fbw.sim.data.slew_on")};
+  FlightDataRecorderResampler gridResampler(FlightDataRecorderConverter::getColumns(selection), simulationTimeField,
+                                            sizeof(FlightDataRecorderSample), 4, "", false);
+  vector<unsigned char> samples(2 * sizeof(FlightDataRecorderSample));
+  auto first = samples.data();
+  auto second = samples.data() + sizeof(FlightDataRecorderSample);
+  FlightDataRecorderSchema::setValue(selection[0], first, 0);
+  FlightDataRecorderSchema::setValue(selection[1], first, 0);
+  FlightDataRecorderSchema::setValue(selection[2], first, 1);
+  FlightDataRecorderSchema::setValue(selection[3], first, 0);
+  FlightDataRecorderSchema::setValue(selection[0], second, 1);
+  FlightDataRecorderSchema::setValue(selection[1], second, 4);
+  FlightDataRecorderSchema::setValue(selection[2], second, 2);
+  FlightDataRecorderSchema::setValue(selection[3], second, 1);
+
+  string buffer;
+  gridResampler.add(buffer, ",", samples.data(), 2);
+  FDR_CHECK_EQUAL(buffer, string("0,0,1,0,\n0.25,1,1,0,\n0.5,2,1,0,\n0.75,3,1,0,\n1,4,2,1,\n"));
+
+  return 0;
+}
@@ -0,0 +1,52 @@
+#include "FlightDataRecorderRingBuffer.h"
+#include "FlightDataRecorderTest.h"
+
+using namespace std;
+
+static void writeSample(FlightDataRecorderRingBuffer& buffer, double simulationTime) {
+  auto slot = buffer.beginWrite();
+  if (slot != nullptr) {
+    slot->ap_sm.time.simulation_time = simulationTime;
+    buffer.endWrite();
+  }
+}
+
+int main() {
+  FlightDataRecorderRingBuffer buffer;
+  buffer.initialize(4);
+  FDR_CHECK_EQUAL(buffer.getCapacity(), 4u);
+  FDR_CHECK(buffer.beginRead() == nullptr);
+
+  // a full ring drops new samples and keeps the old ones
+  for (int i = 0; i < 6; i++) {
+    writeSample(buffer, i);
+  }
+  FDR_CHECK_EQUAL(buffer.getSize(), 4u);
+  FDR_CHECK_EQUAL(buffer.getDroppedSamples(), 2u);
+  FDR_CHECK_EQUAL(buffer.getHighWaterMark(), 4u);
+
+  // samples are read in order and free their slots
+  for (int i = 0; i < 3; i++) {
+    auto sample = buffer.beginRead();
+    FDR_CHECK(sample != nullptr);
+    FDR_CHECK_EQUAL(sample->ap_sm.time.simulation_time, static_cast<double>(i));
+    buffer.endRead();
+  }
+  writeSample(buffer, 6);
+  writeSample(buffer, 7);
+  FDR_CHECK_EQUAL(buffer.getSize(), 3u);
+  FDR_CHECK_EQUAL(buffer.getDroppedSamples(), 2u);
+
+  // the slot index wraps around
+  double expected[] = {3, 6, 7};
+  for (auto simulationTime : expected) {
+    auto sample = buffer.beginRead();
+    FDR_CHECK(sample != nullptr);
+    FDR_CHECK_EQUAL(sample->ap_sm.time.simulation_time, simulationTime);
+    buffer.endRead();
+  }
+  FDR_CHECK(buffer.beginRead() == nullptr);
+  FDR_CHECK_EQUAL(buffer.getHighWaterMark(), 4u);
+
+  return 0;
+}
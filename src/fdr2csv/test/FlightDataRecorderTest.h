@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdlib>
+#include <iostream>
+
+// minimal checks for the tests of the recorder and the converter, a failed check ends the test with exit code 1
+
+#define FDR_CHECK(condition)                                                                   \
+  do {                                                                                         \
+    if (!(condition)) {                                                                        \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;  \
+      std::exit(1);                                                                            \
+    }                                                                                          \
+  } while (false)
+
+#define FDR_CHECK_EQUAL(actual, expected)                                                                             \
+  do {                                                                                                                \
+    auto actualValue = (actual);                                                                                      \
+    auto expectedValue = (expected);                                                                                  \
+    if (!(actualValue == expectedValue)) {                                                                            \
+      std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #actual " = " << actualValue << ", expected "    \
+                << expectedValue << std::endl;                                                                        \
+      std::exit(1);                                                                                                   \
+    }                                                                                                                 \
+  } while (false)